@@ -0,0 +1,481 @@
+#ifndef FUSED_PIPELINE_HPP
+#define FUSED_PIPELINE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Lazy pipeline of lambda stages fused into a single loop:
+//   long long result = data | Pipeline::filter(is_even) | Pipeline::transform(square) | Pipeline::reduce(0LL);
+// - stages (filter, transform) only describe the work - nothing is computed until a terminal
+//   (reduce, sum, count, average, for_each, to_vector, into, partition_into) is applied
+// - items are pushed through all stages one by one - no intermediate containers, one pass over the source
+// - stages can be composed without a source & reused: auto even_squares = filter(is_even) | transform(square);
+// - rvalue ranges are moved into the pipeline (std::views::all), lvalue ranges are referenced
+// - items are passed to stages as references of the source (no copies) - a transform may move them out
+namespace Pipeline
+{
+    struct StageTag
+    {
+    };
+
+    struct TerminalTag
+    {
+    };
+
+    template <typename T>
+    constexpr bool is_stage_v = std::is_base_of_v<StageTag, std::remove_cvref_t<T>>;
+
+    template <typename T>
+    constexpr bool is_terminal_v = std::is_base_of_v<TerminalTag, std::remove_cvref_t<T>>;
+
+    ////////////////////////////////////////////////////////////
+    // stages - stage(item, next) passes zero or more items to next
+
+    template <typename TPredicate>
+    struct Filter : StageTag
+    {
+        TPredicate predicate;
+
+        template <typename TItem>
+        using output_t = TItem;
+
+        template <typename TItem, typename TNext>
+        void operator()(TItem&& item, TNext&& next) const
+        {
+            if (std::invoke(predicate, std::as_const(item)))
+                next(std::forward<TItem>(item));
+        }
+    };
+
+    template <typename TFunction>
+    struct Transform : StageTag
+    {
+        TFunction function;
+
+        template <typename TItem>
+        using output_t = std::invoke_result_t<const TFunction&, TItem>;
+
+        template <typename TItem, typename TNext>
+        void operator()(TItem&& item, TNext&& next) const
+        {
+            next(std::invoke(function, std::forward<TItem>(item)));
+        }
+    };
+
+    template <typename... TStages>
+    struct Chain : StageTag
+    {
+        std::tuple<TStages...> stages;
+    };
+
+    template <typename TPredicate>
+    Filter<TPredicate> filter(TPredicate predicate)
+    {
+        return {{}, std::move(predicate)};
+    }
+
+    template <typename TFunction>
+    Transform<TFunction> transform(TFunction function)
+    {
+        return {{}, std::move(function)};
+    }
+
+    namespace Detail
+    {
+        template <typename TStage>
+        auto as_chain(TStage&& stage)
+        {
+            if constexpr (requires { stage.stages; })
+                return std::forward<TStage>(stage);
+            else
+                return Chain<std::remove_cvref_t<TStage>>{{}, {std::forward<TStage>(stage)}};
+        }
+
+        template <typename TFirst, typename TSecond>
+        auto concat(TFirst&& first, TSecond&& second)
+        {
+            auto first_chain = as_chain(std::forward<TFirst>(first));
+            auto second_chain = as_chain(std::forward<TSecond>(second));
+
+            auto stages = std::tuple_cat(std::move(first_chain.stages), std::move(second_chain.stages));
+            return std::apply([](auto&&... stage) { return Chain<std::remove_cvref_t<decltype(stage)>...>{{}, {std::move(stage)...}}; }, std::move(stages));
+        }
+
+        // type of items that leave the last stage
+        template <typename TItem, typename... TStages>
+        struct Output
+        {
+            using type = TItem;
+        };
+
+        template <typename TItem, typename TStage, typename... TRest>
+        struct Output<TItem, TStage, TRest...>
+        {
+            using type = typename Output<typename TStage::template output_t<TItem>, TRest...>::type;
+        };
+    }
+
+    // stage | stage - composition without a source
+    template <typename TFirst, typename TSecond>
+        requires(is_stage_v<TFirst> && is_stage_v<TSecond>)
+    auto operator|(TFirst&& first, TSecond&& second)
+    {
+        return Detail::concat(std::forward<TFirst>(first), std::forward<TSecond>(second));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // source - range with chain of stages
+
+    template <typename TView, typename... TStages>
+    class Source
+    {
+        TView view_;
+        std::tuple<TStages...> stages_;
+
+        template <size_t Index, typename TSink, typename TItem>
+        void push(TSink& sink, TItem&& item) const
+        {
+            if constexpr (Index == sizeof...(TStages))
+                sink.accept(std::forward<TItem>(item));
+            else
+                std::get<Index>(stages_)(std::forward<TItem>(item), [&](auto&& next_item) {
+                    push<Index + 1>(sink, std::forward<decltype(next_item)>(next_item));
+                });
+        }
+
+    public:
+        using item_type = typename Detail::Output<std::ranges::range_reference_t<TView>, TStages...>::type;
+
+        Source(TView view, Chain<TStages...> chain)
+            : view_{std::move(view)}
+            , stages_{std::move(chain.stages)}
+        {
+        }
+
+        // the only loop - every item of the source goes through all stages into the sink of the terminal
+        template <typename TTerminal>
+        auto run(const TTerminal& terminal)
+        {
+            auto sink = terminal.template make_sink<item_type>();
+
+            for (auto&& item : view_)
+                push<0>(sink, std::forward<decltype(item)>(item));
+
+            return std::move(sink).result();
+        }
+
+        template <typename TStage>
+            requires is_stage_v<TStage>
+        friend auto operator|(Source source, TStage&& stage)
+        {
+            auto chain = Detail::concat(Chain<TStages...>{{}, std::move(source.stages_)}, std::forward<TStage>(stage));
+            return Pipeline::Source(std::move(source.view_), std::move(chain)); // CTAD - not the injected class name
+        }
+
+        template <typename TTerminal>
+            requires is_terminal_v<TTerminal>
+        friend auto operator|(Source& source, const TTerminal& terminal)
+        {
+            return source.run(terminal);
+        }
+
+        template <typename TTerminal>
+            requires is_terminal_v<TTerminal>
+        friend auto operator|(Source&& source, const TTerminal& terminal)
+        {
+            return source.run(terminal);
+        }
+    };
+
+    template <typename TRange, typename TStage>
+        requires(std::ranges::viewable_range<TRange> && is_stage_v<TStage>)
+    auto operator|(TRange&& range, TStage&& stage)
+    {
+        return Source(std::views::all(std::forward<TRange>(range)), Detail::as_chain(std::forward<TStage>(stage)));
+    }
+
+    template <typename TRange, typename TTerminal>
+        requires(std::ranges::viewable_range<TRange> && is_terminal_v<TTerminal>)
+    auto operator|(TRange&& range, const TTerminal& terminal)
+    {
+        return Source(std::views::all(std::forward<TRange>(range)), Chain<>{}).run(terminal);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // terminals - make_sink<TItem>() creates the sink consuming items of the pipeline
+
+    template <typename T, typename TOperation>
+    struct Reduce : TerminalTag
+    {
+        T init;
+        TOperation operation;
+
+        struct Sink
+        {
+            T value;
+            TOperation operation;
+
+            template <typename TItem>
+            void accept(TItem&& item)
+            {
+                value = std::invoke(operation, std::move(value), std::forward<TItem>(item));
+            }
+
+            T result() &&
+            {
+                return std::move(value);
+            }
+        };
+
+        template <typename TItem>
+        Sink make_sink() const
+        {
+            return Sink{init, operation};
+        }
+    };
+
+    template <typename T, typename TOperation = std::plus<>>
+    Reduce<T, TOperation> reduce(T init, TOperation operation = {})
+    {
+        return {{}, std::move(init), std::move(operation)};
+    }
+
+    // sum in the type of items - use reduce(0LL) to avoid overflow
+    struct Sum : TerminalTag
+    {
+        template <typename TItem>
+        auto make_sink() const
+        {
+            return typename Reduce<std::remove_cvref_t<TItem>, std::plus<>>::Sink{std::remove_cvref_t<TItem>{}, {}};
+        }
+    };
+
+    inline Sum sum()
+    {
+        return {};
+    }
+
+    struct Count : TerminalTag
+    {
+        struct Sink
+        {
+            size_t counter = 0;
+
+            template <typename TItem>
+            void accept(TItem&&)
+            {
+                ++counter;
+            }
+
+            size_t result() &&
+            {
+                return counter;
+            }
+        };
+
+        template <typename TItem>
+        Sink make_sink() const
+        {
+            return {};
+        }
+    };
+
+    inline Count count()
+    {
+        return {};
+    }
+
+    // std::nullopt for empty pipeline
+    struct Average : TerminalTag
+    {
+        struct Sink
+        {
+            double sum = 0.0;
+            size_t counter = 0;
+
+            template <typename TItem>
+            void accept(TItem&& item)
+            {
+                sum += item;
+                ++counter;
+            }
+
+            std::optional<double> result() &&
+            {
+                if (counter == 0)
+                    return std::nullopt;
+                return sum / counter;
+            }
+        };
+
+        template <typename TItem>
+        Sink make_sink() const
+        {
+            return {};
+        }
+    };
+
+    inline Average average()
+    {
+        return {};
+    }
+
+    template <typename TFunction>
+    struct ForEach : TerminalTag
+    {
+        TFunction function;
+
+        struct Sink
+        {
+            TFunction function;
+
+            template <typename TItem>
+            void accept(TItem&& item)
+            {
+                std::invoke(function, std::forward<TItem>(item));
+            }
+
+            TFunction result() &&
+            {
+                return std::move(function);
+            }
+        };
+
+        template <typename TItem>
+        Sink make_sink() const
+        {
+            return Sink{function};
+        }
+    };
+
+    // returns the function (like std::for_each)
+    template <typename TFunction>
+    ForEach<TFunction> for_each(TFunction function)
+    {
+        return {{}, std::move(function)};
+    }
+
+    struct ToVector : TerminalTag
+    {
+        template <typename TItem>
+        struct Sink
+        {
+            std::vector<TItem> items;
+
+            template <typename T>
+            void accept(T&& item)
+            {
+                items.push_back(std::forward<T>(item));
+            }
+
+            std::vector<TItem> result() &&
+            {
+                return std::move(items);
+            }
+        };
+
+        template <typename TItem>
+        Sink<std::remove_cvref_t<TItem>> make_sink() const
+        {
+            return {};
+        }
+    };
+
+    inline ToVector to_vector()
+    {
+        return {};
+    }
+
+    // returns the output iterator past the last written item
+    template <typename TOutputIterator>
+    struct Into : TerminalTag
+    {
+        TOutputIterator out;
+
+        struct Sink
+        {
+            TOutputIterator out;
+
+            template <typename TItem>
+            void accept(TItem&& item)
+            {
+                *out = std::forward<TItem>(item);
+                ++out;
+            }
+
+            TOutputIterator result() &&
+            {
+                return std::move(out);
+            }
+        };
+
+        template <typename TItem>
+        Sink make_sink() const
+        {
+            return Sink{out};
+        }
+    };
+
+    template <typename TOutputIterator>
+    Into<TOutputIterator> into(TOutputIterator out)
+    {
+        return {{}, std::move(out)};
+    }
+
+    // returns the pair of output iterators (like std::partition_copy)
+    template <typename TPredicate, typename TOutputTrue, typename TOutputFalse>
+    struct PartitionInto : TerminalTag
+    {
+        TPredicate predicate;
+        TOutputTrue out_true;
+        TOutputFalse out_false;
+
+        struct Sink
+        {
+            TPredicate predicate;
+            TOutputTrue out_true;
+            TOutputFalse out_false;
+
+            template <typename TItem>
+            void accept(TItem&& item)
+            {
+                if (std::invoke(predicate, std::as_const(item)))
+                {
+                    *out_true = std::forward<TItem>(item);
+                    ++out_true;
+                }
+                else
+                {
+                    *out_false = std::forward<TItem>(item);
+                    ++out_false;
+                }
+            }
+
+            std::pair<TOutputTrue, TOutputFalse> result() &&
+            {
+                return {std::move(out_true), std::move(out_false)};
+            }
+        };
+
+        template <typename TItem>
+        Sink make_sink() const
+        {
+            return Sink{predicate, out_true, out_false};
+        }
+    };
+
+    template <typename TPredicate, typename TOutputTrue, typename TOutputFalse>
+    PartitionInto<TPredicate, TOutputTrue, TOutputFalse> partition_into(TPredicate predicate, TOutputTrue out_true, TOutputFalse out_false)
+    {
+        return {{}, std::move(predicate), std::move(out_true), std::move(out_false)};
+    }
+}
+
+#endif
@@ -0,0 +1,354 @@
+#ifndef PARALLEL_ALGORITHMS_HPP
+#define PARALLEL_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Parallel
+{
+    // Fork-join executor with persistent workers:
+    // - run(no_of_chunks, f) calls f(chunk) for every chunk; workers & the calling thread take chunks
+    //   from a shared atomic counter (dynamic load balancing) & run() returns when all chunks are done
+    // - the first exception thrown by f is rethrown from run() (remaining chunks are skipped)
+    // - one job at a time - f must not call run() of the same executor
+    class ChunkedExecutor
+    {
+        std::vector<std::thread> workers_;
+
+        std::mutex mtx_;
+        std::condition_variable cv_start_;
+        std::condition_variable cv_done_;
+        uint64_t generation_{0};
+        size_t busy_workers_{0};
+        bool done_{false};
+
+        // current job - set under the lock before generation_ is incremented
+        void (*job_)(void* context, size_t chunk){nullptr};
+        void* job_context_{nullptr};
+        size_t no_of_chunks_{0};
+        std::atomic<size_t> next_chunk_{0};
+        std::exception_ptr exception_;
+
+    public:
+        explicit ChunkedExecutor(size_t no_of_threads = std::thread::hardware_concurrency())
+        {
+            no_of_threads = std::max<size_t>(no_of_threads, 1);
+
+            workers_.reserve(no_of_threads - 1); // the calling thread is one of the threads
+            for (size_t i = 1; i < no_of_threads; ++i)
+                workers_.emplace_back([this] { work(); });
+        }
+
+        ChunkedExecutor(const ChunkedExecutor&) = delete;
+        ChunkedExecutor& operator=(const ChunkedExecutor&) = delete;
+
+        ~ChunkedExecutor()
+        {
+            {
+                std::lock_guard lk{mtx_};
+                done_ = true;
+            }
+            cv_start_.notify_all();
+
+            for (auto& worker : workers_)
+                worker.join();
+        }
+
+        size_t no_of_threads() const
+        {
+            return workers_.size() + 1;
+        }
+
+        template <typename TFunction>
+        void run(size_t no_of_chunks, TFunction&& f)
+        {
+            if (no_of_chunks == 1 || workers_.empty())
+            {
+                for (size_t chunk = 0; chunk < no_of_chunks; ++chunk)
+                    f(chunk);
+                return;
+            }
+
+            {
+                std::lock_guard lk{mtx_};
+                job_ = [](void* context, size_t chunk) { (*static_cast<std::remove_reference_t<TFunction>*>(context))(chunk); };
+                job_context_ = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+                no_of_chunks_ = no_of_chunks;
+                next_chunk_.store(0, std::memory_order_relaxed);
+                busy_workers_ = workers_.size();
+                ++generation_;
+            }
+            cv_start_.notify_all();
+
+            process_chunks();
+
+            std::unique_lock lk{mtx_};
+            cv_done_.wait(lk, [this] { return busy_workers_ == 0; });
+
+            if (exception_)
+                std::rethrow_exception(std::exchange(exception_, nullptr));
+        }
+
+    private:
+        void process_chunks()
+        {
+            for (size_t chunk; (chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed)) < no_of_chunks_;)
+            {
+                try
+                {
+                    job_(job_context_, chunk);
+                }
+                catch (...)
+                {
+                    std::lock_guard lk{mtx_};
+                    if (!exception_)
+                        exception_ = std::current_exception();
+                    next_chunk_.store(no_of_chunks_, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void work()
+        {
+            uint64_t seen_generation = 0;
+
+            while (true)
+            {
+                {
+                    std::unique_lock lk{mtx_};
+                    cv_start_.wait(lk, [&] { return done_ || generation_ != seen_generation; });
+
+                    if (done_)
+                        return;
+
+                    seen_generation = generation_;
+                }
+
+                process_chunks();
+
+                std::lock_guard lk{mtx_};
+                if (--busy_workers_ == 0)
+                    cv_done_.notify_one();
+            }
+        }
+    };
+
+    namespace Detail
+    {
+        inline constexpr size_t min_chunk_size = 16 * 1024;
+        inline constexpr size_t chunks_per_thread = 4; // load balancing when threads are not equally fast
+
+        // [0, size) split into count contiguous chunks of almost equal size
+        struct Chunks
+        {
+            size_t size;
+            size_t count;
+
+            size_t begin(size_t chunk) const
+            {
+                return size * chunk / count;
+            }
+
+            size_t end(size_t chunk) const
+            {
+                return begin(chunk + 1);
+            }
+        };
+
+        inline Chunks split(size_t size, const ChunkedExecutor& executor)
+        {
+            size_t count = std::clamp<size_t>(size / min_chunk_size, 1, executor.no_of_threads() * chunks_per_thread);
+            return Chunks{size, count};
+        }
+
+        template <typename Iterator>
+        void check_random_access()
+        {
+            static_assert(std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>,
+                "Parallel algorithms require random access iterators");
+        }
+
+        // exclusive prefix sum of counts - counts[i] becomes offset of chunk i; returns total
+        inline size_t to_offsets(std::vector<size_t>& counts)
+        {
+            size_t total = 0;
+            for (auto& count : counts)
+                total += std::exchange(count, total);
+            return total;
+        }
+    }
+
+    // reduce must be associative - partial results of chunks are combined in the order of chunks
+    template <typename InputIt, typename T, typename TReduce, typename TTransform>
+    T transform_reduce(ChunkedExecutor& executor, InputIt first, InputIt last, T init, TReduce reduce, TTransform transform)
+    {
+        Detail::check_random_access<InputIt>();
+
+        if (first == last)
+            return init;
+
+        const auto chunks = Detail::split(last - first, executor);
+        std::vector<std::optional<T>> partial_results(chunks.count);
+
+        executor.run(chunks.count, [&](size_t chunk) {
+            auto it = first + chunks.begin(chunk);
+            const auto end = first + chunks.end(chunk);
+
+            T result = transform(*it);
+            for (++it; it != end; ++it)
+                result = reduce(std::move(result), transform(*it));
+
+            partial_results[chunk] = std::move(result);
+        });
+
+        for (auto& result : partial_results)
+            init = reduce(std::move(init), std::move(*result));
+
+        return init;
+    }
+
+    template <typename InputIt, typename T, typename TReduce = std::plus<>>
+    T reduce(ChunkedExecutor& executor, InputIt first, InputIt last, T init, TReduce reduce = {})
+    {
+        return transform_reduce(executor, first, last, std::move(init), reduce, [](const auto& item) -> const auto& { return item; });
+    }
+
+    template <typename InputIt, typename TPredicate>
+    auto count_if(ChunkedExecutor& executor, InputIt first, InputIt last, TPredicate predicate)
+    {
+        using Difference = typename std::iterator_traits<InputIt>::difference_type;
+
+        return transform_reduce(executor, first, last, Difference{0}, std::plus<>{},
+            [&predicate](const auto& item) -> Difference { return predicate(item) ? 1 : 0; });
+    }
+
+    // f is called concurrently - it must not modify shared state without synchronization
+    template <typename InputIt, typename TFunction>
+    void for_each(ChunkedExecutor& executor, InputIt first, InputIt last, TFunction f)
+    {
+        Detail::check_random_access<InputIt>();
+
+        const auto chunks = Detail::split(last - first, executor);
+
+        executor.run(chunks.count, [&](size_t chunk) {
+            std::for_each(first + chunks.begin(chunk), first + chunks.end(chunk), f);
+        });
+    }
+
+    template <typename InputIt, typename OutputIt, typename TOperation>
+    OutputIt transform(ChunkedExecutor& executor, InputIt first, InputIt last, OutputIt out, TOperation operation)
+    {
+        Detail::check_random_access<InputIt>();
+        Detail::check_random_access<OutputIt>();
+
+        const auto chunks = Detail::split(last - first, executor);
+
+        executor.run(chunks.count, [&](size_t chunk) {
+            std::transform(first + chunks.begin(chunk), first + chunks.end(chunk), out + chunks.begin(chunk), operation);
+        });
+
+        return out + (last - first);
+    }
+
+    // Stable copy_if in two parallel passes (predicate is evaluated twice for every item - it must be pure):
+    // 1. every chunk counts its matching items
+    // 2. prefix sum of counts gives the output offset of every chunk - chunks copy their items independently
+    // The output must be random access & big enough (as for std::copy_if with execution policy)
+    template <typename InputIt, typename OutputIt, typename TPredicate>
+    OutputIt copy_if(ChunkedExecutor& executor, InputIt first, InputIt last, OutputIt out, TPredicate predicate)
+    {
+        Detail::check_random_access<InputIt>();
+        Detail::check_random_access<OutputIt>();
+
+        const auto chunks = Detail::split(last - first, executor);
+        std::vector<size_t> offsets(chunks.count);
+
+        executor.run(chunks.count, [&](size_t chunk) {
+            offsets[chunk] = std::count_if(first + chunks.begin(chunk), first + chunks.end(chunk), predicate);
+        });
+
+        const size_t total = Detail::to_offsets(offsets);
+
+        executor.run(chunks.count, [&](size_t chunk) {
+            std::copy_if(first + chunks.begin(chunk), first + chunks.end(chunk), out + offsets[chunk], predicate);
+        });
+
+        return out + total;
+    }
+
+    // Stable partition_copy - the same scheme as copy_if with two prefix sums
+    template <typename InputIt, typename OutputTrueIt, typename OutputFalseIt, typename TPredicate>
+    std::pair<OutputTrueIt, OutputFalseIt> partition_copy(ChunkedExecutor& executor, InputIt first, InputIt last,
+        OutputTrueIt out_true, OutputFalseIt out_false, TPredicate predicate)
+    {
+        Detail::check_random_access<InputIt>();
+        Detail::check_random_access<OutputTrueIt>();
+        Detail::check_random_access<OutputFalseIt>();
+
+        const auto chunks = Detail::split(last - first, executor);
+        std::vector<size_t> true_offsets(chunks.count);
+        std::vector<size_t> false_offsets(chunks.count);
+
+        executor.run(chunks.count, [&](size_t chunk) {
+            true_offsets[chunk] = std::count_if(first + chunks.begin(chunk), first + chunks.end(chunk), predicate);
+            false_offsets[chunk] = chunks.end(chunk) - chunks.begin(chunk) - true_offsets[chunk];
+        });
+
+        const size_t total_true = Detail::to_offsets(true_offsets);
+        const size_t total_false = Detail::to_offsets(false_offsets);
+
+        executor.run(chunks.count, [&](size_t chunk) {
+            std::partition_copy(first + chunks.begin(chunk), first + chunks.end(chunk),
+                out_true + true_offsets[chunk], out_false + false_offsets[chunk], predicate);
+        });
+
+        return {out_true + total_true, out_false + total_false};
+    }
+
+    // Stable in-place remove_if:
+    // 1. every chunk is compacted in parallel (the predicate is evaluated once for every item)
+    // 2. compacted runs are moved to their final positions in the order of chunks (sequential memory move -
+    //    a run may overlap the source of the previous run)
+    template <typename ForwardIt, typename TPredicate>
+    ForwardIt remove_if(ChunkedExecutor& executor, ForwardIt first, ForwardIt last, TPredicate predicate)
+    {
+        Detail::check_random_access<ForwardIt>();
+
+        const auto chunks = Detail::split(last - first, executor);
+        std::vector<size_t> kept(chunks.count);
+
+        executor.run(chunks.count, [&](size_t chunk) {
+            const auto chunk_first = first + chunks.begin(chunk);
+            kept[chunk] = std::remove_if(chunk_first, first + chunks.end(chunk), predicate) - chunk_first;
+        });
+
+        ForwardIt result = first + kept[0];
+        for (size_t chunk = 1; chunk < chunks.count; ++chunk)
+        {
+            const auto run_first = first + chunks.begin(chunk);
+
+            if (result == run_first)
+                result += kept[chunk];
+            else
+                result = std::move(run_first, run_first + kept[chunk], result);
+        }
+
+        return result;
+    }
+}
+
+#endif
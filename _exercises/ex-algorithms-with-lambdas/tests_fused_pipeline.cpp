@@ -0,0 +1,303 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+#include "fused_pipeline.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+TEST_CASE("lambda exercise - fused pipeline")
+{
+    using namespace Catch::Matchers;
+    using namespace Pipeline;
+
+    vector<int> data = {1, 6, 3, 5, 8, 9, 13, 12, 10, 45};
+    auto is_even = [](int n) { return n % 2 == 0; };
+    auto square = [](int x) { return x * x; };
+
+    SECTION("count even numbers")
+    {
+        REQUIRE((data | filter(is_even) | count()) == 4);
+    }
+
+    SECTION("copy evens to vector")
+    {
+        vector<int> evens = data | filter(is_even) | to_vector();
+
+        REQUIRE_THAT(evens, Equals(vector<int>{6, 8, 12, 10}));
+    }
+
+    SECTION("create container with squares")
+    {
+        vector<int> squares = data | transform(square) | to_vector();
+
+        REQUIRE_THAT(squares, Equals(vector<int>{1, 36, 9, 25, 64, 81, 169, 144, 100, 2025}));
+    }
+
+    SECTION("remove from container items divisible by any number from a given array")
+    {
+        const array<int, 3> eliminators = {3, 5, 7};
+
+        auto is_kept = [&eliminators](int val) {
+            return std::none_of(eliminators.begin(), eliminators.end(), [val](int eliminator) { return val % eliminator == 0; });
+        };
+
+        REQUIRE_THAT(data | filter(is_kept) | to_vector(), Equals(vector<int>{1, 8, 13}));
+    }
+
+    SECTION("calculate average")
+    {
+        double avg = *(data | average());
+
+        REQUIRE_THAT(avg, WithinAbs(11.2, 0.1));
+
+        SECTION("create two containers - 1st with numbers less or equal to average & 2nd with numbers greater than average")
+        {
+            vector<int> less_equal_than_avg;
+            vector<int> greater_than_avg;
+
+            data | partition_into([avg](int a) { return a <= avg; }, std::back_inserter(less_equal_than_avg), std::back_inserter(greater_than_avg));
+
+            REQUIRE_THAT(less_equal_than_avg, Equals(vector<int>{1, 6, 3, 5, 8, 9, 10}));
+            REQUIRE_THAT(greater_than_avg, Equals(vector<int>{13, 12, 45}));
+        }
+    }
+
+    SECTION("sum of squares of evens - filter, transform & reduce in one pass")
+    {
+        REQUIRE((data | filter(is_even) | transform(square) | reduce(0LL)) == 36 + 64 + 144 + 100);
+    }
+}
+
+TEST_CASE("fused pipeline is lazy")
+{
+    using namespace Pipeline;
+
+    vector<int> data = {1, 2, 3, 4, 5, 6};
+    vector<string> log;
+
+    auto pipeline = data
+        | filter([&log](int n) { log.push_back("filter " + to_string(n)); return n % 2 == 0; })
+        | transform([&log](int n) { log.push_back("transform " + to_string(n)); return n * 10; });
+
+    SECTION("nothing is computed before a terminal is applied")
+    {
+        CHECK(log.empty());
+    }
+
+    SECTION("items go through all stages one by one")
+    {
+        CHECK((pipeline | sum()) == 120);
+        CHECK(log == vector<string>{"filter 1", "filter 2", "transform 2", "filter 3", "filter 4", "transform 4", "filter 5", "filter 6", "transform 6"});
+    }
+
+    SECTION("lvalue source is referenced - pipeline sees current items")
+    {
+        data.back() = 8;
+        CHECK((pipeline | sum()) == 140);
+    }
+}
+
+TEST_CASE("fused pipeline - composition & terminals")
+{
+    using namespace Pipeline;
+
+    auto is_even = [](int n) { return n % 2 == 0; };
+
+    SECTION("stages composed without a source can be reused")
+    {
+        auto even_squares = filter(is_even) | transform([](int x) { return static_cast<long long>(x) * x; });
+
+        vector<int> vec = {1, 2, 3, 4};
+        list<int> lst = {10, 11, 12};
+
+        CHECK((vec | even_squares | reduce(0LL)) == 20);
+        CHECK((lst | even_squares | reduce(0LL)) == 244);
+        CHECK((vec | even_squares | transform([](long long x) { return x + 1; }) | to_vector()) == vector<long long>{5, 17});
+    }
+
+    SECTION("transform changes the type of items")
+    {
+        vector<int> data = {1, 22, 333};
+
+        auto lengths = data | transform([](int n) { return to_string(n); }) | transform(&string::size) | to_vector();
+
+        static_assert(std::is_same_v<decltype(lengths), vector<size_t>>);
+        CHECK(lengths == vector<size_t>{1, 2, 3});
+    }
+
+    SECTION("rvalue source is moved into the pipeline")
+    {
+        auto pipeline = vector<int>{1, 2, 3, 4} | filter(is_even);
+
+        CHECK((pipeline | count()) == 2);
+    }
+
+    SECTION("items are passed by reference - move-only items can be moved out")
+    {
+        vector<unique_ptr<int>> ptrs;
+        for (int i = 1; i <= 4; ++i)
+            ptrs.push_back(make_unique<int>(i));
+
+        auto odd_ptrs = std::move(ptrs) | filter([](const unique_ptr<int>& ptr) { return *ptr % 2 != 0; })
+            | transform([](unique_ptr<int>& ptr) { return std::move(ptr); }) | to_vector();
+
+        REQUIRE(odd_ptrs.size() == 2);
+        CHECK(*odd_ptrs[0] == 1);
+        CHECK(*odd_ptrs[1] == 3);
+    }
+
+    SECTION("reduce with custom operation, for_each & into")
+    {
+        vector<int> data = {3, 1, 4, 1, 5};
+
+        CHECK((data | reduce(numeric_limits<int>::min(), [](int a, int b) { return std::max(a, b); })) == 5);
+
+        auto counter = data | for_each([n = 0](int) mutable { ++n; return n; });
+        CHECK(counter(0) == 6);
+
+        vector<int> target(3);
+        auto end = data | filter([](int n) { return n != 1; }) | into(target.begin());
+        CHECK(end == target.end());
+        CHECK(target == vector<int>{3, 4, 5});
+    }
+
+    SECTION("empty source")
+    {
+        vector<int> empty;
+
+        CHECK((empty | filter(is_even) | count()) == 0);
+        CHECK((empty | sum()) == 0);
+        CHECK_FALSE((empty | average()).has_value());
+        CHECK((empty | to_vector()).empty());
+    }
+}
+
+////////////////////////////////////////////////////////////
+// benchmark - multi-pass STL with intermediate containers vs fused single pass
+
+namespace
+{
+    template <typename TFunction>
+    double best_time_ms(TFunction&& f, int repetitions = 3)
+    {
+        double best = std::numeric_limits<double>::max();
+
+        for (int i = 0; i < repetitions; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            [[maybe_unused]] volatile auto result = f(); // result must not be optimized away
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count());
+        }
+
+        return best;
+    }
+
+    // memory traffic is estimated from sizes of containers - every pass reads its input & writes its output
+    struct Traffic
+    {
+        size_t bytes_moved = 0;
+        size_t bytes_allocated = 0; // intermediate containers (capacity)
+    };
+
+    template <typename T>
+    void add_intermediate(Traffic& traffic, const std::vector<T>& container)
+    {
+        traffic.bytes_moved += 2 * container.size() * sizeof(T); // written by one pass & read by the next one
+        traffic.bytes_allocated += container.capacity() * sizeof(T);
+    }
+
+    void print_row(const std::string& label, double ms, const Traffic& traffic)
+    {
+        constexpr double mb = 1024.0 * 1024.0;
+
+        std::cout << std::setw(36) << std::left << label << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << ms << std::setw(16) << traffic.bytes_moved / mb << std::setw(16) << traffic.bytes_allocated / mb << "\n";
+    }
+
+    constexpr auto is_even = [](int n) { return n % 2 == 0; };
+    constexpr auto square = [](int x) { return static_cast<long long>(x) * x; };
+    constexpr auto is_small = [](int n) { return n < 100'000; };
+}
+
+TEST_CASE("fused pipeline vs multi-pass STL", "[.][benchmark]")
+{
+    constexpr size_t size = 100'000'000;
+
+    vector<int> data(size);
+    std::mt19937 rnd{42};
+    std::generate(data.begin(), data.end(), [&] { return static_cast<int>(rnd() % 1'000'000); });
+
+    const Traffic source_only{size * sizeof(int), 0};
+
+    std::cout << "\n" << size << " ints\n"
+              << std::setw(36) << std::left << "" << std::right << std::setw(12) << "time [ms]" << std::setw(16) << "traffic [MB]"
+              << std::setw(16) << "allocated [MB]" << "\n";
+
+    // sum of squares of evens: filter -> transform -> reduce
+    {
+        Traffic traffic = source_only;
+
+        double ms = best_time_ms([&] {
+            traffic = source_only;
+
+            vector<int> evens;
+            std::copy_if(data.begin(), data.end(), std::back_inserter(evens), is_even);
+
+            vector<long long> squares;
+            std::transform(evens.begin(), evens.end(), std::back_inserter(squares), square);
+
+            add_intermediate(traffic, evens);
+            add_intermediate(traffic, squares);
+
+            return std::accumulate(squares.begin(), squares.end(), 0LL);
+        });
+        print_row("filter/transform/reduce - STL", ms, traffic);
+
+        ms = best_time_ms([&] {
+            auto even_squares = data | std::views::filter(is_even) | std::views::transform(square);
+            return std::accumulate(even_squares.begin(), even_squares.end(), 0LL);
+        });
+        print_row("filter/transform/reduce - views", ms, source_only);
+
+        ms = best_time_ms([&] { return data | Pipeline::filter(is_even) | Pipeline::transform(square) | Pipeline::reduce(0LL); });
+        print_row("filter/transform/reduce - fused", ms, source_only);
+
+        CHECK((data | Pipeline::filter(is_even) | Pipeline::transform(square) | Pipeline::reduce(0LL))
+            == std::transform_reduce(data.begin(), data.end(), 0LL, std::plus<>{}, [](int x) { return is_even(x) ? square(x) : 0LL; }));
+    }
+
+    // average of small items: filter -> average
+    {
+        Traffic traffic = source_only;
+
+        double ms = best_time_ms([&] {
+            traffic = source_only;
+
+            vector<int> small_items;
+            std::copy_if(data.begin(), data.end(), std::back_inserter(small_items), is_small);
+
+            add_intermediate(traffic, small_items);
+
+            return std::accumulate(small_items.begin(), small_items.end(), 0.0) / small_items.size();
+        });
+        print_row("filter/average - STL", ms, traffic);
+
+        ms = best_time_ms([&] { return *(data | Pipeline::filter(is_small) | Pipeline::average()); });
+        print_row("filter/average - fused", ms, source_only);
+    }
+}
@@ -0,0 +1,299 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_all.hpp>
+#include "parallel_algorithms.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef HAS_STD_PARALLEL_ALGORITHMS
+#include <execution>
+#endif
+
+using namespace std;
+
+TEST_CASE("lambda exercise - parallel")
+{
+    using namespace Catch::Matchers;
+
+    Parallel::ChunkedExecutor executor{4};
+
+    vector<int> data = {1, 6, 3, 5, 8, 9, 13, 12, 10, 45};
+    auto is_even = [](int n) { return n % 2 == 0; };
+
+    SECTION("count even numbers")
+    {
+        auto evens_count = Parallel::count_if(executor, data.begin(), data.end(), is_even);
+
+        REQUIRE(evens_count == 4);
+    }
+
+    SECTION("copy evens to vector")
+    {
+        vector<int> evens(data.size());
+
+        evens.erase(Parallel::copy_if(executor, data.begin(), data.end(), evens.begin(), is_even), evens.end());
+
+        REQUIRE_THAT(evens, Equals(vector<int>{6, 8, 12, 10}));
+    }
+
+    SECTION("create container with squares")
+    {
+        vector<int> squares(data.size());
+
+        Parallel::transform(executor, data.begin(), data.end(), squares.begin(), [](int x) { return x * x; });
+
+        REQUIRE_THAT(squares, Equals(vector<int>{1, 36, 9, 25, 64, 81, 169, 144, 100, 2025}));
+    }
+
+    SECTION("remove from container items divisible by any number from a given array")
+    {
+        const array<int, 3> eliminators = {3, 5, 7};
+
+        auto new_end = Parallel::remove_if(executor, data.begin(), data.end(), [&eliminators](int val) {
+            return std::any_of(eliminators.begin(), eliminators.end(), [val](int eliminator) { return val % eliminator == 0; });
+        });
+
+        data.erase(new_end, data.end());
+
+        REQUIRE_THAT(data, Equals(vector<int>{1, 8, 13}));
+    }
+
+    SECTION("calculate average")
+    {
+        double avg = Parallel::reduce(executor, data.begin(), data.end(), 0.0) / data.size();
+
+        REQUIRE_THAT(avg, WithinAbs(11.2, 0.1));
+
+        SECTION("create two containers - 1st with numbers less or equal to average & 2nd with numbers greater than average")
+        {
+            vector<int> less_equal_than_avg(data.size());
+            vector<int> greater_than_avg(data.size());
+
+            auto [end_less_equal, end_greater] = Parallel::partition_copy(executor, data.begin(), data.end(),
+                less_equal_than_avg.begin(), greater_than_avg.begin(), [avg](int a) { return a <= avg; });
+
+            less_equal_than_avg.erase(end_less_equal, less_equal_than_avg.end());
+            greater_than_avg.erase(end_greater, greater_than_avg.end());
+
+            REQUIRE_THAT(less_equal_than_avg, Equals(vector<int>{1, 6, 3, 5, 8, 9, 10}));
+            REQUIRE_THAT(greater_than_avg, Equals(vector<int>{13, 12, 45}));
+        }
+    }
+}
+
+TEST_CASE("parallel algorithms give the same results as sequential ones")
+{
+    Parallel::ChunkedExecutor executor{4};
+
+    std::mt19937 rnd{665};
+    vector<int> data(1'000'003); // many chunks with uneven sizes
+    std::generate(data.begin(), data.end(), [&] { return static_cast<int>(rnd() % 1000); });
+
+    auto is_small = [](int n) { return n < 300; };
+
+    SECTION("count_if & reduce")
+    {
+        CHECK(Parallel::count_if(executor, data.begin(), data.end(), is_small) == std::count_if(data.begin(), data.end(), is_small));
+        CHECK(Parallel::reduce(executor, data.begin(), data.end(), 0LL) == std::accumulate(data.begin(), data.end(), 0LL));
+    }
+
+    SECTION("copy_if is stable")
+    {
+        vector<int> expected;
+        std::copy_if(data.begin(), data.end(), std::back_inserter(expected), is_small);
+
+        vector<int> result(data.size());
+        result.erase(Parallel::copy_if(executor, data.begin(), data.end(), result.begin(), is_small), result.end());
+
+        CHECK(result == expected);
+    }
+
+    SECTION("partition_copy is stable")
+    {
+        vector<int> expected_true, expected_false;
+        std::partition_copy(data.begin(), data.end(), std::back_inserter(expected_true), std::back_inserter(expected_false), is_small);
+
+        vector<int> result_true(data.size()), result_false(data.size());
+        auto [end_true, end_false] = Parallel::partition_copy(executor, data.begin(), data.end(), result_true.begin(), result_false.begin(), is_small);
+        result_true.erase(end_true, result_true.end());
+        result_false.erase(end_false, result_false.end());
+
+        CHECK(result_true == expected_true);
+        CHECK(result_false == expected_false);
+    }
+
+    SECTION("remove_if is stable")
+    {
+        vector<int> expected = data;
+        expected.erase(std::remove_if(expected.begin(), expected.end(), is_small), expected.end());
+
+        data.erase(Parallel::remove_if(executor, data.begin(), data.end(), is_small), data.end());
+
+        CHECK(data == expected);
+    }
+
+    SECTION("empty range")
+    {
+        vector<int> empty;
+
+        CHECK(Parallel::count_if(executor, empty.begin(), empty.end(), is_small) == 0);
+        CHECK(Parallel::copy_if(executor, empty.begin(), empty.end(), data.begin(), is_small) == data.begin());
+        CHECK(Parallel::remove_if(executor, empty.begin(), empty.end(), is_small) == empty.end());
+    }
+
+    SECTION("exception thrown in a chunk is rethrown")
+    {
+        auto throwing = [](int n) {
+            if (n == 999)
+                throw std::runtime_error{"ERROR"};
+            return n;
+        };
+
+        vector<int> result(data.size());
+        CHECK_THROWS_AS(Parallel::transform(executor, data.begin(), data.end(), result.begin(), throwing), std::runtime_error);
+
+        CHECK(Parallel::count_if(executor, data.begin(), data.end(), is_small) == std::count_if(data.begin(), data.end(), is_small)); // executor is still usable
+    }
+}
+
+#ifdef HAS_STD_PARALLEL_ALGORITHMS
+TEST_CASE("lambda exercise - std::execution::par_unseq")
+{
+    using namespace Catch::Matchers;
+
+    vector<int> data = {1, 6, 3, 5, 8, 9, 13, 12, 10, 45};
+    auto is_even = [](int n) { return n % 2 == 0; };
+
+    REQUIRE(std::count_if(std::execution::par_unseq, data.begin(), data.end(), is_even) == 4);
+
+    vector<int> evens(data.size());
+    evens.resize(std::copy_if(std::execution::par_unseq, data.begin(), data.end(), evens.begin(), is_even) - evens.begin());
+    REQUIRE_THAT(evens, Equals(vector<int>{6, 8, 12, 10}));
+
+    double avg = std::reduce(std::execution::par_unseq, data.begin(), data.end(), 0.0) / data.size();
+    REQUIRE_THAT(avg, WithinAbs(11.2, 0.1));
+}
+#endif
+
+////////////////////////////////////////////////////////////
+// scaling benchmark - all pipelines of the exercise on big data set
+
+namespace
+{
+    template <typename TFunction>
+    double best_time_ms(TFunction&& f, int repetitions = 5)
+    {
+        double best = std::numeric_limits<double>::max();
+
+        for (int i = 0; i < repetitions; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            if constexpr (std::is_void_v<decltype(f())>)
+                f();
+            else
+                [[maybe_unused]] volatile auto result = f(); // result must not be optimized away
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count());
+        }
+
+        return best;
+    }
+
+    // lambdas (not functions) - the predicate is inlined also when it is passed through the executor
+    constexpr auto is_even = [](int n) { return n % 2 == 0; };
+
+    constexpr auto is_eliminated = [](int n) { return n % 3 == 0 || n % 5 == 0 || n % 7 == 0; };
+
+    // run(print) calls print(time_in_ms) for every pipeline
+    template <typename TRun>
+    void print_row(const std::string& label, TRun&& run)
+    {
+        std::cout << std::setw(20) << std::left << label << std::right << std::fixed << std::setprecision(1);
+        run([](double ms) { std::cout << std::setw(16) << ms; });
+        std::cout << "\n";
+    }
+}
+
+TEST_CASE("parallel pipelines - scaling", "[.][benchmark]")
+{
+    constexpr size_t size = 100'000'000;
+
+    vector<int> data(size);
+    std::mt19937 rnd{42};
+    std::generate(data.begin(), data.end(), [&] { return static_cast<int>(rnd() % 1'000'000); });
+
+    vector<int> output(size);
+    vector<int> second_output(size);
+    vector<int> scratch(size);
+
+    std::cout << "\n" << size << " ints - time in ms (hardware threads: " << std::thread::hardware_concurrency() << ")\n";
+    std::cout << std::setw(20) << std::left << "" << std::right;
+    for (const char* name : {"count_if", "copy_if", "transform", "copy+remove_if", "reduce", "partition_copy"})
+        std::cout << std::setw(16) << name;
+    std::cout << "\n";
+
+    print_row("sequential", [&](auto print) {
+        print(best_time_ms([&] { return std::count_if(data.begin(), data.end(), is_even); }));
+        print(best_time_ms([&] { std::copy_if(data.begin(), data.end(), output.begin(), is_even); }));
+        print(best_time_ms([&] { std::transform(data.begin(), data.end(), output.begin(), [](int x) { return x * x; }); }));
+        print(best_time_ms([&] {
+            scratch = data;
+            std::remove_if(scratch.begin(), scratch.end(), is_eliminated);
+        }));
+        print(best_time_ms([&] { return std::accumulate(data.begin(), data.end(), 0LL); }));
+        print(best_time_ms([&] {
+            std::partition_copy(data.begin(), data.end(), output.begin(), second_output.begin(), [](int x) { return x <= 500'000; });
+        }));
+    });
+
+#ifdef HAS_STD_PARALLEL_ALGORITHMS
+    print_row("par_unseq", [&](auto print) {
+        constexpr auto policy = std::execution::par_unseq;
+        print(best_time_ms([&] { return std::count_if(policy, data.begin(), data.end(), is_even); }));
+        print(best_time_ms([&] { std::copy_if(policy, data.begin(), data.end(), output.begin(), is_even); }));
+        print(best_time_ms([&] { std::transform(policy, data.begin(), data.end(), output.begin(), [](int x) { return x * x; }); }));
+        print(best_time_ms([&] {
+            std::copy(policy, data.begin(), data.end(), scratch.begin());
+            std::remove_if(policy, scratch.begin(), scratch.end(), is_eliminated);
+        }));
+        print(best_time_ms([&] { return std::reduce(policy, data.begin(), data.end(), 0LL); }));
+        print(best_time_ms([&] {
+            std::partition_copy(policy, data.begin(), data.end(), output.begin(), second_output.begin(), [](int x) { return x <= 500'000; });
+        }));
+    });
+#endif
+
+    std::vector<size_t> thread_counts;
+    for (size_t threads = 1; threads < std::thread::hardware_concurrency(); threads *= 2)
+        thread_counts.push_back(threads);
+    thread_counts.push_back(std::max(std::thread::hardware_concurrency(), 1u));
+
+    for (size_t threads : thread_counts)
+    {
+        Parallel::ChunkedExecutor executor{threads};
+
+        print_row("chunked - " + std::to_string(threads) + " thr", [&](auto print) {
+            print(best_time_ms([&] { return Parallel::count_if(executor, data.begin(), data.end(), is_even); }));
+            print(best_time_ms([&] { Parallel::copy_if(executor, data.begin(), data.end(), output.begin(), is_even); }));
+            print(best_time_ms([&] { Parallel::transform(executor, data.begin(), data.end(), output.begin(), [](int x) { return x * x; }); }));
+            print(best_time_ms([&] {
+                Parallel::transform(executor, data.begin(), data.end(), scratch.begin(), [](int x) { return x; });
+                Parallel::remove_if(executor, scratch.begin(), scratch.end(), is_eliminated);
+            }));
+            print(best_time_ms([&] { return Parallel::reduce(executor, data.begin(), data.end(), 0LL); }));
+            print(best_time_ms([&] {
+                Parallel::partition_copy(executor, data.begin(), data.end(), output.begin(), second_output.begin(), [](int x) { return x <= 500'000; });
+            }));
+        });
+    }
+}
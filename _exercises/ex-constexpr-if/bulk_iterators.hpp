@@ -0,0 +1,148 @@
+#ifndef BULK_ITERATORS_HPP
+#define BULK_ITERATORS_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace Iterators
+{
+    namespace Detail
+    {
+        template <typename Iterator>
+        using category_t = typename std::iterator_traits<Iterator>::iterator_category;
+
+        template <typename Iterator>
+        constexpr bool is_random_access_v = std::is_base_of_v<std::random_access_iterator_tag, category_t<Iterator>>;
+
+        // contiguous range of trivially copyable objects - can be copied with memmove/memset
+        // (concepts - the conjunction stops before std::iter_value_t of an output iterator is formed)
+        template <typename Iterator>
+        concept contiguous_trivial_iterator = std::contiguous_iterator<Iterator>
+            && std::is_trivially_copyable_v<std::iter_value_t<Iterator>>;
+
+        template <typename InputIterator, typename OutputIterator>
+        concept memmove_copyable = contiguous_trivial_iterator<InputIterator>
+            && std::contiguous_iterator<OutputIterator>
+            && std::is_same_v<std::iter_value_t<InputIterator>, std::iter_value_t<OutputIterator>>
+            && !std::is_const_v<std::remove_reference_t<std::iter_reference_t<OutputIterator>>>;
+
+        template <typename InputIterator, typename OutputIterator>
+        OutputIterator copy_n_loop(InputIterator first, size_t n, OutputIterator out)
+        {
+            for (; n > 0; --n, ++first, ++out)
+                *out = *first;
+            return out;
+        }
+    }
+
+    // it += n for random access iterators, n-times ++it otherwise
+    // returns the tag of the chosen implementation
+    template <typename Iterator>
+    auto advance_it(Iterator& it, size_t n)
+    {
+        if constexpr (Detail::is_random_access_v<Iterator>)
+        {
+            it += static_cast<std::iter_difference_t<Iterator>>(n);
+            return std::random_access_iterator_tag{};
+        }
+        else
+        {
+            for (; n > 0; --n)
+                ++it;
+            return std::input_iterator_tag{};
+        }
+    }
+
+    // last - first for random access iterators, counting loop otherwise
+    template <typename Iterator>
+    auto distance_it(Iterator first, Iterator last)
+    {
+        using Difference = std::iter_difference_t<Iterator>;
+
+        if constexpr (Detail::is_random_access_v<Iterator>)
+        {
+            return static_cast<Difference>(last - first);
+        }
+        else
+        {
+            Difference count = 0;
+            for (; first != last; ++first)
+                ++count;
+            return count;
+        }
+    }
+
+    // copies n items & returns iterator past the last copied item:
+    // - memmove for contiguous ranges of the same trivially copyable type (ranges may overlap)
+    // - indexed loop for random access iterators (no iterator dependency chain - vectorizable)
+    // - loop with ++ otherwise (lists, streams, inserters)
+    template <typename InputIterator, typename OutputIterator>
+    OutputIterator copy_n_it(InputIterator first, size_t n, OutputIterator out)
+    {
+        if constexpr (Detail::memmove_copyable<InputIterator, OutputIterator>)
+        {
+            if (n > 0)
+                std::memmove(std::to_address(out), std::to_address(first), n * sizeof(std::iter_value_t<InputIterator>));
+            return out + static_cast<std::iter_difference_t<OutputIterator>>(n);
+        }
+        else if constexpr (Detail::is_random_access_v<InputIterator> && Detail::is_random_access_v<OutputIterator>)
+        {
+            using Difference = std::iter_difference_t<InputIterator>;
+
+            const auto size = static_cast<Difference>(n);
+            for (Difference i = 0; i < size; ++i)
+                out[i] = first[i];
+            return out + size;
+        }
+        else
+        {
+            return Detail::copy_n_loop(first, n, out);
+        }
+    }
+
+    // assigns value to n items & returns iterator past the last item:
+    // - memset for contiguous ranges of bytes
+    // - doubling memcpy (1, 2, 4, ... items copied from the already filled prefix)
+    //   for contiguous ranges of other trivially copyable types
+    // - loop otherwise
+    template <typename OutputIterator, typename T>
+    OutputIterator fill_n_it(OutputIterator first, size_t n, const T& value)
+    {
+        if constexpr (Detail::contiguous_trivial_iterator<OutputIterator>)
+        {
+            using Value = std::iter_value_t<OutputIterator>;
+
+            if (n == 0)
+                return first;
+
+            Value* data = std::to_address(first);
+
+            if constexpr (sizeof(Value) == 1)
+            {
+                const Value item = value;
+                std::memset(data, std::bit_cast<unsigned char>(item), n);
+            }
+            else
+            {
+                data[0] = value;
+                for (size_t filled = 1; filled < n; filled *= 2)
+                    std::memcpy(data + filled, data, std::min(filled, n - filled) * sizeof(Value));
+            }
+
+            return first + static_cast<std::iter_difference_t<OutputIterator>>(n);
+        }
+        else
+        {
+            for (; n > 0; --n, ++first)
+                *first = value;
+            return first;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,185 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "bulk_iterators.hpp"
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Iterators;
+
+TEST_CASE("implementation is selected by iterator category")
+{
+    static_assert(Detail::memmove_copyable<std::vector<int>::iterator, std::vector<int>::iterator>);
+    static_assert(Detail::memmove_copyable<const double*, double*>);
+    static_assert(!Detail::memmove_copyable<std::vector<int>::iterator, std::vector<long>::iterator>);
+    static_assert(!Detail::memmove_copyable<std::vector<std::string>::iterator, std::vector<std::string>::iterator>);
+    static_assert(!Detail::memmove_copyable<std::deque<int>::iterator, std::deque<int>::iterator>);
+
+    static_assert(Detail::is_random_access_v<std::deque<int>::iterator>);
+    static_assert(!Detail::is_random_access_v<std::list<int>::iterator>);
+}
+
+TEST_CASE("distance_it")
+{
+    std::vector<int> vec(100);
+    std::list<int> lst(100);
+    std::istringstream stream{"1 2 3 4"};
+
+    CHECK(distance_it(vec.begin(), vec.end()) == 100);
+    CHECK(distance_it(lst.begin(), lst.end()) == 100);
+    CHECK(distance_it(std::istream_iterator<int>{stream}, std::istream_iterator<int>{}) == 4);
+}
+
+TEST_CASE("copy_n_it")
+{
+    std::vector<int> source(100);
+    std::iota(source.begin(), source.end(), 0);
+
+    SECTION("contiguous - memmove")
+    {
+        std::vector<int> target(100, -1);
+
+        auto end = copy_n_it(source.begin(), 50, target.begin());
+
+        CHECK(end == target.begin() + 50);
+        CHECK(std::equal(target.begin(), end, source.begin()));
+        CHECK(target[50] == -1);
+    }
+
+    SECTION("contiguous - overlapping ranges")
+    {
+        copy_n_it(source.begin(), 10, source.begin() + 5);
+
+        CHECK(std::vector(source.begin(), source.begin() + 15) == std::vector{0, 1, 2, 3, 4, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SECTION("converting types & non-trivial types - random access loop")
+    {
+        std::vector<long> longs(100);
+        copy_n_it(source.begin(), 100, longs.begin());
+        CHECK(std::equal(longs.begin(), longs.end(), source.begin()));
+
+        std::vector<std::string> words = {"one", "two", "three"};
+        std::deque<std::string> target(3);
+        copy_n_it(words.begin(), 3, target.begin());
+        CHECK(std::equal(target.begin(), target.end(), words.begin()));
+    }
+
+    SECTION("list & inserters - loop")
+    {
+        std::list<int> lst(source.begin(), source.end());
+        std::vector<int> target;
+
+        copy_n_it(lst.begin(), 10, std::back_inserter(target));
+
+        CHECK(target == std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SECTION("n == 0")
+    {
+        std::vector<int> target;
+        CHECK(copy_n_it(source.begin(), 0, target.begin()) == target.begin());
+    }
+}
+
+TEST_CASE("fill_n_it")
+{
+    SECTION("bytes - memset")
+    {
+        std::array<char, 16> buffer{};
+
+        auto end = fill_n_it(buffer.begin(), 10, 'x');
+
+        CHECK(end == buffer.begin() + 10);
+        CHECK(std::string(buffer.data()) == "xxxxxxxxxx");
+    }
+
+    SECTION("trivially copyable - doubling memcpy")
+    {
+        for (size_t n : {1, 2, 3, 7, 8, 1000})
+        {
+            std::vector<double> vec(n + 1, 0.0);
+
+            fill_n_it(vec.begin(), n, 3.14);
+
+            CHECK(std::count(vec.begin(), vec.end(), 3.14) == static_cast<long>(n));
+            CHECK(vec.back() == 0.0);
+        }
+    }
+
+    SECTION("list & strings - loop")
+    {
+        std::list<std::string> lst(5);
+
+        fill_n_it(lst.begin(), 3, "text");
+
+        CHECK(std::count(lst.begin(), lst.end(), "text") == 3);
+    }
+}
+
+TEST_CASE("bulk iterator operations - vector vs list", "[.][benchmark]")
+{
+    constexpr size_t size = 1'000'000;
+
+    std::vector<int> source_vec(size);
+    std::iota(source_vec.begin(), source_vec.end(), 0);
+    std::vector<int> target_vec(size);
+
+    std::list<int> source_lst(source_vec.begin(), source_vec.end());
+    std::list<int> target_lst(size);
+
+    BENCHMARK("copy_n - vector (memmove)")
+    {
+        return copy_n_it(source_vec.begin(), size, target_vec.begin());
+    };
+
+    BENCHMARK("copy_n - vector (loop with ++)")
+    {
+        return Detail::copy_n_loop(source_vec.begin(), size, target_vec.begin());
+    };
+
+    BENCHMARK("copy_n - list")
+    {
+        return copy_n_it(source_lst.begin(), size, target_lst.begin());
+    };
+
+    BENCHMARK("fill_n - vector (doubling memcpy)")
+    {
+        return fill_n_it(target_vec.begin(), size, 42);
+    };
+
+    BENCHMARK("fill_n - list")
+    {
+        return fill_n_it(target_lst.begin(), size, 42);
+    };
+
+    BENCHMARK("distance - vector")
+    {
+        return distance_it(source_vec.begin(), source_vec.end());
+    };
+
+    BENCHMARK("distance - list")
+    {
+        return distance_it(source_lst.begin(), source_lst.end());
+    };
+
+    BENCHMARK("advance - vector")
+    {
+        auto it = source_vec.begin();
+        advance_it(it, size / 2);
+        return *it;
+    };
+
+    BENCHMARK("advance - list")
+    {
+        auto it = source_lst.begin();
+        advance_it(it, size / 2);
+        return *it;
+    };
+}
@@ -0,0 +1,211 @@
+#ifndef LOOKUP_TABLE_HPP
+#define LOOKUP_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ex
+{
+    template <typename T, size_t N>
+    struct Array
+    {
+        T items[N];
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        constexpr reference operator[](size_t index)
+        {
+            return items[index];
+        }
+
+        constexpr const_reference operator[](size_t index) const
+        {
+            return items[index];
+        }
+
+        constexpr size_t size() const
+        {
+            return N;
+        }
+
+        constexpr T* data()
+        {
+            return items;
+        }
+
+        constexpr const T* data() const
+        {
+            return items;
+        }
+
+        constexpr iterator begin()
+        {
+            return &items[0];
+        }
+
+        constexpr iterator end()
+        {
+            return begin() + N;
+        }
+
+        constexpr const_iterator begin() const
+        {
+            return &items[0];
+        }
+
+        constexpr const_iterator end() const
+        {
+            return begin() + N;
+        }
+    };
+
+    template <typename T, size_t N>
+    constexpr bool operator==(const Array<T, N>& left, const Array<T, N>& right)
+    {
+        auto it_left = left.begin();
+        auto it_right = right.begin();
+        for (; it_left != left.end(); ++it_left, ++it_right)
+            if (*it_left != *it_right)
+                return false;
+        return true;
+    }
+
+    // Table of N values: table[i] = generator(i)
+    // - generator is called for i = 0, 1, ..., N - 1 in this order - it can keep state (mutable lambda)
+    // - result stored in constexpr variable is computed by the compiler & placed in read-only data
+    //   (no initialization at startup)
+    template <size_t N, typename TGenerator>
+    constexpr auto make_lookup(TGenerator generator)
+    {
+        using T = std::remove_cvref_t<std::invoke_result_t<TGenerator&, size_t>>;
+
+        Array<T, N> table{};
+        for (size_t i = 0; i < N; ++i)
+            table[i] = generator(i);
+
+        return table;
+    }
+
+    template <size_t N>
+    constexpr Array<uintmax_t, N> create_fibonacci_lookup()
+    {
+        static_assert(N <= 94, "fib(94) does not fit in uintmax_t");
+
+        return make_lookup<N>([previous = uintmax_t{0}, current = uintmax_t{1}](size_t) mutable {
+            return std::exchange(previous, std::exchange(current, previous + current));
+        });
+    }
+
+    namespace Lookups
+    {
+        inline constexpr auto fibonacci = create_fibonacci_lookup<94>();
+
+        ////////////////////////////////////////////////////////////
+        // CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320)
+
+        inline constexpr auto crc32_table = make_lookup<256>([](size_t index) {
+            auto crc = static_cast<uint32_t>(index);
+            for (int bit = 0; bit < 8; ++bit)
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+            return crc;
+        });
+
+        constexpr uint32_t crc32(std::string_view data) noexcept
+        {
+            uint32_t crc = 0xFFFFFFFFu;
+            for (char c : data)
+                crc = crc32_table[(crc ^ static_cast<unsigned char>(c)) & 0xFFu] ^ (crc >> 8);
+            return ~crc;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // number of set bits in a byte
+
+        inline constexpr auto popcount_table = make_lookup<256>([](size_t byte) {
+            uint8_t count = 0;
+            for (; byte != 0; byte &= byte - 1)
+                ++count;
+            return count;
+        });
+
+        constexpr int popcount(uint64_t value) noexcept
+        {
+            int count = 0;
+            for (; value != 0; value >>= 8)
+                count += popcount_table[value & 0xFFu];
+            return count;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // sin & cos in fixed-point Q15 format (value * 32767) - angles in 1/1024 of the full turn
+
+        namespace Detail
+        {
+            // std::sin is not constexpr in C++20 - Taylor series after reduction to [-pi, pi]
+            constexpr double sin(double x)
+            {
+                constexpr double two_pi = 2.0 * std::numbers::pi;
+
+                x -= two_pi * static_cast<double>(static_cast<long long>(x / two_pi));
+                if (x > std::numbers::pi)
+                    x -= two_pi;
+                else if (x < -std::numbers::pi)
+                    x += two_pi;
+
+                double term = x;
+                double sum = x;
+                for (int n = 1; n < 20; ++n)
+                {
+                    term *= -x * x / ((2 * n) * (2 * n + 1));
+                    sum += term;
+                }
+
+                return sum;
+            }
+
+            constexpr int16_t to_q15(double value)
+            {
+                double scaled = value * 32767.0;
+                return static_cast<int16_t>(scaled >= 0.0 ? scaled + 0.5 : scaled - 0.5);
+            }
+        }
+
+        inline constexpr size_t angle_steps = 1024; // full turn
+
+        inline constexpr auto sin_q15_table = make_lookup<angle_steps>([](size_t angle) {
+            return Detail::to_q15(Detail::sin(2.0 * std::numbers::pi * static_cast<double>(angle) / angle_steps));
+        });
+
+        constexpr int16_t sin_q15(uint32_t angle) noexcept
+        {
+            return sin_q15_table[angle % angle_steps];
+        }
+
+        // cos(x) == sin(x + quarter of the turn) - the same table
+        constexpr int16_t cos_q15(uint32_t angle) noexcept
+        {
+            return sin_q15_table[(angle + angle_steps / 4) % angle_steps];
+        }
+
+        ////////////////////////////////////////////////////////////
+        // n! mod p for n < 1024
+
+        inline constexpr uint64_t factorial_modulus = 1'000'000'007;
+
+        inline constexpr auto factorial_mod_table = make_lookup<1024>([factorial = uint64_t{1}](size_t n) mutable {
+            if (n > 0)
+                factorial = factorial * n % factorial_modulus;
+            return static_cast<uint32_t>(factorial);
+        });
+    }
+}
+
+#endif
@@ -0,0 +1,232 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "lookup_table.hpp"
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ex;
+
+namespace
+{
+    uintmax_t fibonacci(size_t n)
+    {
+        uintmax_t previous = 0;
+        uintmax_t current = 1;
+        for (size_t i = 0; i < n; ++i)
+            previous = std::exchange(current, previous + current);
+        return previous;
+    }
+
+    uint32_t crc32_bitwise(std::string_view data)
+    {
+        uint32_t crc = 0xFFFFFFFFu;
+        for (char c : data)
+        {
+            crc ^= static_cast<unsigned char>(c);
+            for (int bit = 0; bit < 8; ++bit)
+                crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+        return ~crc;
+    }
+
+    int popcount_loop(uint64_t value)
+    {
+        int count = 0;
+        for (; value != 0; value &= value - 1)
+            ++count;
+        return count;
+    }
+
+    int16_t sin_q15_runtime(uint32_t angle)
+    {
+        double value = std::sin(2.0 * std::numbers::pi * (angle % Lookups::angle_steps) / Lookups::angle_steps);
+        return static_cast<int16_t>(std::lround(value * 32767.0));
+    }
+
+    uint32_t factorial_mod(size_t n)
+    {
+        uint64_t factorial = 1;
+        for (size_t i = 2; i <= n; ++i)
+            factorial = factorial * i % Lookups::factorial_modulus;
+        return static_cast<uint32_t>(factorial);
+    }
+}
+
+TEST_CASE("make_lookup")
+{
+    constexpr auto squares = make_lookup<5>([](size_t i) { return static_cast<int>(i * i); });
+
+    static_assert(squares == Array<int, 5>{0, 1, 4, 9, 16});
+
+    SECTION("stateful generator is called in order")
+    {
+        constexpr auto powers_of_two = make_lookup<4>([power = 1](size_t) mutable { return std::exchange(power, power * 2); });
+
+        static_assert(powers_of_two == Array<int, 4>{1, 2, 4, 8});
+    }
+}
+
+TEST_CASE("lookup tables are computed at compile time")
+{
+    SECTION("fibonacci")
+    {
+        static_assert(Lookups::fibonacci.size() == 94);
+        static_assert(Lookups::fibonacci[10] == 55);
+        static_assert(Lookups::fibonacci[93] == 12'200'160'415'121'876'738u);
+
+        for (size_t n = 0; n < Lookups::fibonacci.size(); ++n)
+            CHECK(Lookups::fibonacci[n] == fibonacci(n));
+    }
+
+    SECTION("crc32")
+    {
+        static_assert(Lookups::crc32_table[1] == 0x77073096u);
+        static_assert(Lookups::crc32_table[255] == 0x2D02EF8Du);
+        static_assert(Lookups::crc32("123456789") == 0xCBF43926u); // check value of CRC-32/ISO-HDLC
+
+        const std::string text = "The quick brown fox jumps over the lazy dog";
+        CHECK(Lookups::crc32(text) == crc32_bitwise(text));
+        CHECK(Lookups::crc32(text) == 0x414FA339u);
+    }
+
+    SECTION("popcount")
+    {
+        static_assert(Lookups::popcount_table[0] == 0);
+        static_assert(Lookups::popcount_table[0xFF] == 8);
+        static_assert(Lookups::popcount(0xF0F0'0000'0000'0001u) == 9);
+
+        for (uint64_t value : {0ull, 1ull, 0xDEADBEEFull, ~0ull, 0x8000'0000'0000'0000ull})
+            CHECK(Lookups::popcount(value) == std::popcount(value));
+    }
+
+    SECTION("sin & cos in Q15")
+    {
+        static_assert(Lookups::sin_q15(0) == 0);
+        static_assert(Lookups::sin_q15(256) == 32767);  // 90 deg
+        static_assert(Lookups::sin_q15(768) == -32767); // 270 deg
+        static_assert(Lookups::cos_q15(0) == 32767);
+        static_assert(Lookups::cos_q15(512) == -32767);
+
+        for (uint32_t angle = 0; angle < Lookups::angle_steps; ++angle)
+            CHECK(std::abs(Lookups::sin_q15(angle) - sin_q15_runtime(angle)) <= 1);
+    }
+
+    SECTION("factorial mod p")
+    {
+        static_assert(Lookups::factorial_mod_table[0] == 1);
+        static_assert(Lookups::factorial_mod_table[10] == 3'628'800);
+        static_assert(Lookups::factorial_mod_table[20] == 146'326'063);
+
+        for (size_t n : {0, 1, 12, 13, 100, 1023})
+            CHECK(Lookups::factorial_mod_table[n] == factorial_mod(n));
+    }
+}
+
+TEST_CASE("lookup vs computation", "[.][benchmark]")
+{
+    std::mt19937_64 rnd{42};
+
+    std::vector<size_t> indexes(4096);
+    for (auto& index : indexes)
+        index = rnd() % 94;
+
+    std::vector<uint64_t> words(4096);
+    for (auto& word : words)
+        word = rnd();
+
+    std::vector<uint32_t> angles(4096);
+    for (auto& angle : angles)
+        angle = static_cast<uint32_t>(rnd());
+
+    std::string buffer(1 << 20, '\0');
+    for (auto& c : buffer)
+        c = static_cast<char>(rnd());
+
+    BENCHMARK("fibonacci - computed")
+    {
+        uintmax_t sum = 0;
+        for (size_t n : indexes)
+            sum += fibonacci(n);
+        return sum;
+    };
+
+    BENCHMARK("fibonacci - lookup")
+    {
+        uintmax_t sum = 0;
+        for (size_t n : indexes)
+            sum += Lookups::fibonacci[n];
+        return sum;
+    };
+
+    BENCHMARK("crc32 of 1MB - bitwise")
+    {
+        return crc32_bitwise(buffer);
+    };
+
+    BENCHMARK("crc32 of 1MB - lookup")
+    {
+        return Lookups::crc32(buffer);
+    };
+
+    BENCHMARK("popcount - loop")
+    {
+        long sum = 0;
+        for (uint64_t word : words)
+            sum += popcount_loop(word);
+        return sum;
+    };
+
+    BENCHMARK("popcount - lookup")
+    {
+        long sum = 0;
+        for (uint64_t word : words)
+            sum += Lookups::popcount(word);
+        return sum;
+    };
+
+    BENCHMARK("popcount - std::popcount")
+    {
+        long sum = 0;
+        for (uint64_t word : words)
+            sum += std::popcount(word);
+        return sum;
+    };
+
+    BENCHMARK("sin Q15 - std::sin")
+    {
+        long sum = 0;
+        for (uint32_t angle : angles)
+            sum += sin_q15_runtime(angle);
+        return sum;
+    };
+
+    BENCHMARK("sin Q15 - lookup")
+    {
+        long sum = 0;
+        for (uint32_t angle : angles)
+            sum += Lookups::sin_q15(angle);
+        return sum;
+    };
+
+    BENCHMARK("factorial mod p - computed")
+    {
+        uint64_t sum = 0;
+        for (size_t n : indexes)
+            sum += factorial_mod(n * 10);
+        return sum;
+    };
+
+    BENCHMARK("factorial mod p - lookup")
+    {
+        uint64_t sum = 0;
+        for (size_t n : indexes)
+            sum += Lookups::factorial_mod_table[n * 10];
+        return sum;
+    };
+}
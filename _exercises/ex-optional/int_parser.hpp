@@ -0,0 +1,147 @@
+#ifndef INT_PARSER_HPP
+#define INT_PARSER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Parsing
+{
+    // whole text must be a number (the same format as std::from_chars: optional '-', no spaces, no '+')
+    inline std::optional<int> to_int(std::string_view text)
+    {
+        int value{};
+        auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+        if (ec != std::errc{} || end != text.data() + text.size())
+            return std::nullopt;
+
+        return value;
+    }
+
+    namespace Detail
+    {
+        // SWAR (SIMD within a register) - 8 ASCII chars in one 64-bit word, the first char in the lowest byte
+        inline bool is_made_of_eight_digits(uint64_t chunk)
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0) | (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+        }
+
+        // converts 8 digits with 3 multiplications (D. Lemire) - pairs, quads & the whole word
+        inline uint32_t parse_eight_digits(uint64_t chunk)
+        {
+            constexpr uint64_t mask = 0x000000FF000000FF;
+            constexpr uint64_t mul_1 = 100 + (1000000ULL << 32);
+            constexpr uint64_t mul_2 = 1 + (10000ULL << 32);
+
+            chunk -= 0x3030303030303030;
+            chunk = (chunk * 10) + (chunk >> 8);
+            chunk = (((chunk & mask) * mul_1) + (((chunk >> 16) & mask) * mul_2)) >> 32;
+
+            return static_cast<uint32_t>(chunk);
+        }
+
+        // fields of up to 8 digits (optionally with '-') are validated & converted without loops over chars
+        inline std::optional<int> to_int_swar(std::string_view text)
+        {
+            bool is_negative = !text.empty() && text.front() == '-';
+            std::string_view digits = text.substr(is_negative);
+
+            if (digits.empty() || digits.size() > 8 || std::endian::native != std::endian::little)
+                return to_int(text);
+
+            uint64_t chunk = 0x3030303030303030; // leading '0's
+            std::memcpy(reinterpret_cast<char*>(&chunk) + (8 - digits.size()), digits.data(), digits.size());
+
+            if (!is_made_of_eight_digits(chunk))
+                return std::nullopt;
+
+            int value = static_cast<int>(parse_eight_digits(chunk));
+
+            return is_negative ? -value : value;
+        }
+    }
+
+    // Column of nullable ints - values are stored densely & nulls are marked in the validity bitmap
+    class IntColumn
+    {
+        std::vector<int> values_;
+        std::vector<uint64_t> validity_;
+
+    public:
+        explicit IntColumn(size_t size = 0)
+            : values_(size)
+            , validity_((size + 63) / 64)
+        {
+        }
+
+        size_t size() const
+        {
+            return values_.size();
+        }
+
+        bool is_valid(size_t index) const
+        {
+            return (validity_[index / 64] >> (index % 64)) & 1;
+        }
+
+        std::optional<int> operator[](size_t index) const
+        {
+            return is_valid(index) ? std::optional{values_[index]} : std::nullopt;
+        }
+
+        size_t null_count() const
+        {
+            size_t valid_count = 0;
+            for (uint64_t word : validity_)
+                valid_count += std::popcount(word);
+            return size() - valid_count;
+        }
+
+        // values of nulls are 0
+        std::span<const int> values() const
+        {
+            return values_;
+        }
+
+        std::span<const uint64_t> validity() const
+        {
+            return validity_;
+        }
+
+        friend IntColumn parse_int_column(std::span<const std::string_view> fields);
+    };
+
+    // parses all fields - invalid fields become nulls
+    // - bitmap is built 64 fields at a time (one store per word)
+    inline IntColumn parse_int_column(std::span<const std::string_view> fields)
+    {
+        IntColumn column(fields.size());
+
+        for (size_t first = 0; first < fields.size(); first += 64)
+        {
+            size_t last = std::min(first + 64, fields.size());
+            uint64_t validity_word = 0;
+
+            for (size_t i = first; i < last; ++i)
+            {
+                std::optional<int> value = Detail::to_int_swar(fields[i]);
+                column.values_[i] = value.value_or(0);
+                validity_word |= uint64_t{value.has_value()} << (i - first);
+            }
+
+            column.validity_[first / 64] = validity_word;
+        }
+
+        return column;
+    }
+}
+
+#endif
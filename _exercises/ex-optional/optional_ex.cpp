@@ -1,50 +1,52 @@
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include "int_parser.hpp"
 #include <charconv>
 #include <optional>
+#include <string>
 #include <string_view>
 
-// TODO: implement to_int(std::string_view) function
+using Parsing::to_int;
 
-// TEST_CASE("to_int returning optional")
-// {
-//     SECTION("happy path")
-//     {
-//         using namespace std::literals;
+TEST_CASE("to_int returning optional")
+{
+    SECTION("happy path")
+    {
+        using namespace std::literals;
 
-//         SECTION("string to int")
-//         {
-//             auto result = to_int("123"s);
+        SECTION("string to int")
+        {
+            auto result = to_int("123"s);
 
-//             REQUIRE(result.has_value());
-//             REQUIRE(*result == 123);
-//         }
+            REQUIRE(result.has_value());
+            REQUIRE(*result == 123);
+        }
 
-//         SECTION("const char* to int")
-//         {
-//             auto result = to_int("123");
+        SECTION("const char* to int")
+        {
+            auto result = to_int("123");
 
-//             REQUIRE(result.has_value());
-//             REQUIRE(*result == 123);
-//         }
-//     }
+            REQUIRE(result.has_value());
+            REQUIRE(*result == 123);
+        }
+    }
 
-//     SECTION("sad path")
-//     {
-//         SECTION("whole string invalid")
-//         {
-//             auto result = to_int("a");
+    SECTION("sad path")
+    {
+        SECTION("whole string invalid")
+        {
+            auto result = to_int("a");
 
-//             REQUIRE_FALSE(result.has_value());
-//         }
+            REQUIRE_FALSE(result.has_value());
+        }
 
-//         SECTION("part of string is invalid")
-//         {
-//             using namespace std::literals;
+        SECTION("part of string is invalid")
+        {
+            using namespace std::literals;
 
-//             auto result = to_int("123a4"sv);
+            auto result = to_int("123a4"sv);
 
-//             REQUIRE_FALSE(result.has_value());
-//         }
-//     }
-// }
\ No newline at end of file
+            REQUIRE_FALSE(result.has_value());
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "int_parser.hpp"
+#include <chrono>
+#include <climits>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("SWAR digit parsing")
+{
+    using namespace Parsing::Detail;
+
+    SECTION("agrees with to_int")
+    {
+        for (std::string_view field : {"0"sv, "7"sv, "-7"sv, "42"sv, "007"sv, "12345678"sv, "-12345678"sv, "99999999"sv,
+                 "123456789"sv, "2147483647"sv, "-2147483648"sv, "2147483648"sv, // longer than 8 digits - from_chars
+                 ""sv, "-"sv, "--1"sv, "+1"sv, " 1"sv, "1 "sv, "12a4"sv, "1/"sv, "1:"sv, "0x10"sv, "\xb1"sv})
+        {
+            INFO("field: " << field);
+            CHECK(to_int_swar(field) == Parsing::to_int(field));
+        }
+    }
+
+    SECTION("every byte value is validated")
+    {
+        for (int c = 0; c < 256; ++c)
+        {
+            std::string field = "12" + std::string(1, static_cast<char>(c)) + "4";
+            INFO("char code: " << c);
+            CHECK(to_int_swar(field) == Parsing::to_int(field));
+        }
+    }
+}
+
+TEST_CASE("parse_int_column")
+{
+    std::vector<std::string_view> fields;
+    for (int i = 0; i < 130; ++i)
+        fields.push_back(i % 3 == 0 ? "n/a"sv : "-15"sv);
+
+    Parsing::IntColumn column = Parsing::parse_int_column(fields);
+
+    REQUIRE(column.size() == 130);
+    CHECK(column.null_count() == 44);
+
+    for (size_t i = 0; i < fields.size(); ++i)
+    {
+        INFO("index: " << i);
+        CHECK(column[i] == (i % 3 == 0 ? std::nullopt : std::optional{-15}));
+    }
+
+    CHECK(column.values()[0] == 0);
+    CHECK(column.validity().size() == 3);
+}
+
+TEST_CASE("parsing int fields", "[.][benchmark]")
+{
+    constexpr size_t no_of_fields = 10'000'000;
+
+    std::mt19937 rnd{665};
+    std::uniform_int_distribution<int> value_distr{-1'000'000, 10'000'000};
+    std::uniform_int_distribution<int> null_distr{0, 99};
+
+    std::string buffer;
+    buffer.reserve(no_of_fields * 9);
+    std::vector<std::pair<size_t, size_t>> positions;
+
+    for (size_t i = 0; i < no_of_fields; ++i)
+    {
+        std::string field = null_distr(rnd) == 0 ? "NULL" : std::to_string(value_distr(rnd));
+        positions.emplace_back(buffer.size(), field.size());
+        buffer += field;
+    }
+
+    std::vector<std::string_view> fields;
+    for (auto [offset, size] : positions)
+        fields.push_back(std::string_view{buffer}.substr(offset, size));
+
+    auto per_call_from_chars = [&] {
+        std::vector<std::optional<int>> column(fields.size());
+        for (size_t i = 0; i < fields.size(); ++i)
+            column[i] = Parsing::to_int(fields[i]);
+        return column.size();
+    };
+
+    auto per_call_stoi = [&] {
+        std::vector<std::optional<int>> column(fields.size());
+        for (size_t i = 0; i < fields.size(); ++i)
+        {
+            try
+            {
+                std::string field{fields[i]};
+                size_t pos{};
+                int value = std::stoi(field, &pos);
+                if (pos == field.size())
+                    column[i] = value;
+            }
+            catch (const std::invalid_argument&)
+            {
+            }
+            catch (const std::out_of_range&)
+            {
+            }
+        }
+        return column.size();
+    };
+
+    auto batch = [&] { return Parsing::parse_int_column(fields).size(); };
+
+    auto print_throughput = [&](std::string_view name, auto parse) {
+        auto start = std::chrono::steady_clock::now();
+        parse();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << name << ": " << no_of_fields / elapsed.count() / 1e6 << " M fields/s; "
+                  << buffer.size() / elapsed.count() / 1e9 << " GB/s\n";
+    };
+
+    print_throughput("std::stoi per call", per_call_stoi);
+    print_throughput("std::from_chars per call", per_call_from_chars);
+    print_throughput("parse_int_column", batch);
+
+    BENCHMARK("std::stoi per call")
+    {
+        return per_call_stoi();
+    };
+
+    BENCHMARK("std::from_chars per call")
+    {
+        return per_call_from_chars();
+    };
+
+    BENCHMARK("parse_int_column")
+    {
+        return batch();
+    };
+}
@@ -0,0 +1,214 @@
+#ifndef ASYNC_SUBJECT_HPP
+#define ASYNC_SUBJECT_HPP
+
+#include "observer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Subject that delivers events asynchronously - a slow observer does not stall the producer:
+// - set_state() formats the event once & publishes it as a shared payload (one allocation per event)
+// - events published while the dispatcher is busy are coalesced into one batch (one lock & one wake-up)
+// - the dispatcher thread copies the batch to per-observer queues & calls update() for at most
+//   max_batch_size events of every observer per round, so an observer with a long backlog
+//   does not delay events for the others
+// - registrations, unregistrations & events share one inbox & are applied in the order of calls:
+//   registered observer gets events published after the registration, unregistered observer gets no more events
+// - pending events are delivered before the destructor returns
+class AsyncSubject
+{
+public:
+    using Event = std::shared_ptr<const std::string>;
+
+private:
+    struct Mailbox
+    {
+        std::weak_ptr<Observer> observer;
+        std::deque<Event> events;
+    };
+
+    struct Registration
+    {
+        std::weak_ptr<Observer> observer;
+    };
+
+    struct Unregistration
+    {
+        std::weak_ptr<Observer> observer;
+    };
+
+    using Command = std::variant<Event, Registration, Unregistration>;
+
+    std::atomic<int> state_{0};
+    size_t max_batch_size_;
+
+    std::mutex mtx_;
+    std::condition_variable cv_inbox_;
+    std::condition_variable cv_idle_;
+    std::vector<Command> inbox_;
+    bool is_idle_{true};
+    bool done_{false};
+
+    std::vector<Mailbox> mailboxes_; // accessed only by the dispatcher
+    std::thread dispatcher_;
+
+public:
+    explicit AsyncSubject(size_t max_batch_size = 64)
+        : max_batch_size_{std::max<size_t>(max_batch_size, 1)}
+        , dispatcher_{[this] { dispatch(); }}
+    {
+    }
+
+    AsyncSubject(const AsyncSubject&) = delete;
+    AsyncSubject& operator=(const AsyncSubject&) = delete;
+
+    ~AsyncSubject()
+    {
+        {
+            std::lock_guard lk{mtx_};
+            done_ = true;
+        }
+        cv_inbox_.notify_one();
+        dispatcher_.join();
+    }
+
+    void register_observer(std::weak_ptr<Observer> observer)
+    {
+        post(Registration{std::move(observer)});
+    }
+
+    void unregister_observer(std::weak_ptr<Observer> observer)
+    {
+        post(Unregistration{std::move(observer)});
+    }
+
+    void set_state(int new_state)
+    {
+        if (state_.exchange(new_state, std::memory_order_relaxed) != new_state)
+            notify(std::make_shared<const std::string>("State has been set to: " + std::to_string(new_state)));
+    }
+
+    // blocks until all events published so far are delivered
+    void flush()
+    {
+        std::unique_lock lk{mtx_};
+        cv_idle_.wait(lk, [this] { return is_idle_; });
+    }
+
+protected:
+    void notify(Event event)
+    {
+        post(std::move(event));
+    }
+
+private:
+    void post(Command command)
+    {
+        bool was_idle;
+
+        {
+            std::lock_guard lk{mtx_};
+            inbox_.push_back(std::move(command));
+            was_idle = std::exchange(is_idle_, false);
+        }
+
+        if (was_idle) // busy dispatcher takes the whole inbox after the current round
+            cv_inbox_.notify_one();
+    }
+
+    bool has_pending_events() const
+    {
+        return std::ranges::any_of(mailboxes_, [](const Mailbox& m) { return !m.events.empty(); });
+    }
+
+    void dispatch()
+    {
+        std::vector<Command> batch;
+
+        while (true)
+        {
+            {
+                std::unique_lock lk{mtx_};
+
+                if (inbox_.empty() && !has_pending_events())
+                {
+                    is_idle_ = true;
+                    cv_idle_.notify_all();
+
+                    cv_inbox_.wait(lk, [this] { return done_ || !inbox_.empty(); });
+
+                    if (inbox_.empty())
+                        return;
+
+                    is_idle_ = false;
+                }
+
+                batch.swap(inbox_);
+            }
+
+            for (auto& command : batch)
+                std::visit([this](auto& cmd) { apply(cmd); }, command);
+
+            batch.clear();
+
+            deliver_round();
+        }
+    }
+
+    void apply(Event& event)
+    {
+        for (auto& mailbox : mailboxes_)
+            mailbox.events.push_back(event);
+    }
+
+    void apply(Registration& registration)
+    {
+        mailboxes_.push_back(Mailbox{std::move(registration.observer), {}});
+    }
+
+    void apply(const Unregistration& unregistration)
+    {
+        const auto& observer = unregistration.observer;
+
+        std::erase_if(mailboxes_, [&](const Mailbox& m) {
+            return !m.observer.owner_before(observer) && !observer.owner_before(m.observer);
+        });
+    }
+
+    void deliver_round()
+    {
+        bool has_expired_observers = false;
+
+        for (auto& mailbox : mailboxes_)
+        {
+            if (mailbox.events.empty())
+                continue;
+
+            std::shared_ptr<Observer> living_observer = mailbox.observer.lock(); // once per batch
+            if (!living_observer)
+            {
+                has_expired_observers = true;
+                continue;
+            }
+
+            for (size_t i = 0; i < max_batch_size_ && !mailbox.events.empty(); ++i)
+            {
+                living_observer->update(*mailbox.events.front());
+                mailbox.events.pop_front();
+            }
+        }
+
+        if (has_expired_observers)
+            std::erase_if(mailboxes_, [](const Mailbox& m) { return m.observer.expired(); });
+    }
+};
+
+#endif
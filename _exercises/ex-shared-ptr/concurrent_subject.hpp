@@ -0,0 +1,114 @@
+#ifndef CONCURRENT_SUBJECT_HPP
+#define CONCURRENT_SUBJECT_HPP
+
+#include "observer.hpp"
+#include "rcu_cell.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Subject that can be notified & (un)registered from many threads at once:
+// - observers are kept in an immutable RCU snapshot - notify() never blocks on registrations
+// - register/unregister copy the list (O(n)) & drop observers that have already expired
+// - notify() marks that expired observers were found & removes them after the loop if no other writer
+//   holds the lock (try_update - notify never waits for writers); prune() removes them unconditionally
+// - nested notify (set_state from update()) skips pruning - it would wait for its own snapshot
+// - observers must not (un)register themselves from update() (writers wait for readers)
+class ConcurrentSubject
+{
+    using Observers = std::vector<std::weak_ptr<Observer>>;
+
+    std::atomic<int> state_{0};
+    Concurrency::RcuCell<Observers> observers_;
+    std::atomic<bool> has_expired_observers_{false};
+    static inline thread_local int notify_depth_{0};
+
+public:
+    void register_observer(std::weak_ptr<Observer> observer)
+    {
+        observers_.update([&](const Observers& observers) {
+            Observers updated = alive(observers);
+            updated.push_back(std::move(observer));
+            return updated;
+        });
+    }
+
+    void unregister_observer(const std::weak_ptr<Observer>& observer)
+    {
+        observers_.update([&](const Observers& observers) {
+            Observers updated = alive(observers);
+            std::erase_if(updated, [&](const auto& o) { return !o.owner_before(observer) && !observer.owner_before(o); });
+            return updated;
+        });
+    }
+
+    // removes expired observers if notify() has found any
+    void prune()
+    {
+        if (has_expired_observers_.exchange(false, std::memory_order_relaxed))
+            observers_.update([](const Observers& observers) { return alive(observers); });
+    }
+
+    size_t no_of_observers() const
+    {
+        return observers_.read()->size();
+    }
+
+    void set_state(int new_state)
+    {
+        if (state_.exchange(new_state, std::memory_order_relaxed) != new_state)
+            notify("State has been set to: " + std::to_string(new_state));
+    }
+
+protected:
+    void notify(const std::string& event_args)
+    {
+        {
+            struct DepthGuard
+            {
+                int& depth;
+
+                ~DepthGuard()
+                {
+                    --depth;
+                }
+            } depth_guard{++notify_depth_};
+
+            auto observers = observers_.read();
+
+            for (const auto& observer : *observers)
+            {
+                if (std::shared_ptr<Observer> living_observer = observer.lock())
+                    living_observer->update(event_args);
+                else if (!has_expired_observers_.load(std::memory_order_relaxed))
+                    has_expired_observers_.store(true, std::memory_order_relaxed);
+            }
+        } // snapshot must be released before pruning
+
+        if (notify_depth_ == 0)
+            try_prune();
+    }
+
+private:
+    void try_prune()
+    {
+        if (!has_expired_observers_.exchange(false, std::memory_order_relaxed))
+            return;
+
+        if (!observers_.try_update([](const Observers& observers) { return alive(observers); }))
+            has_expired_observers_.store(true, std::memory_order_relaxed); // left for the next notify or prune
+    }
+
+    static Observers alive(const Observers& observers)
+    {
+        Observers result;
+        result.reserve(observers.size() + 1);
+        std::ranges::copy_if(observers, std::back_inserter(result), [](const auto& o) { return !o.expired(); });
+        return result;
+    }
+};
+
+#endif
@@ -1,19 +1,13 @@
 #include <catch2/catch_test_macros.hpp>
+#include "observer.hpp"
 #include <cassert>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
 
-class Observer
-{
-public:
-    virtual void update(const std::string& event_args) = 0;
-    // virtual void update(std::any event_args) = 0;
-    virtual ~Observer() { }
-};
-
 class Subject
 {
     int state_;
@@ -0,0 +1,14 @@
+#ifndef OBSERVER_HPP
+#define OBSERVER_HPP
+
+#include <string>
+
+class Observer
+{
+public:
+    virtual void update(const std::string& event_args) = 0;
+    // virtual void update(std::any event_args) = 0;
+    virtual ~Observer() { }
+};
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef RCU_CELL_HPP
+#define RCU_CELL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Concurrency
+{
+    inline constexpr size_t cache_line_size = 64;
+
+    // Read-copy-update cell - immutable snapshot of T published by an atomic pointer:
+    // - read() is wait-free: epoch load + one counter increment + pointer load (no locks, no CAS loops)
+    // - update() copies the current snapshot, publishes the modified copy & frees the old one
+    //   after all readers that could see it are gone (two epoch flips as in userspace RCU)
+    // - writers are serialized by a mutex & they wait for readers - update() must not be called
+    //   by a thread that holds a ReadGuard of the same cell
+    // - try_update() gives up instead of waiting when another writer holds the lock
+    template <typename T>
+    class RcuCell
+    {
+        struct alignas(cache_line_size) ReaderCounter
+        {
+            std::atomic<int64_t> value{0};
+        };
+
+        std::atomic<const T*> current_;
+        std::atomic<unsigned> epoch_{0};
+        mutable ReaderCounter readers_[2];
+        std::mutex mtx_writers_;
+
+    public:
+        class ReadGuard
+        {
+            ReaderCounter* counter_;
+            const T* snapshot_;
+
+        public:
+            ReadGuard(ReaderCounter* counter, const T* snapshot) noexcept
+                : counter_{counter}
+                , snapshot_{snapshot}
+            {
+            }
+
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+
+            ~ReadGuard()
+            {
+                counter_->value.fetch_sub(1, std::memory_order_release);
+            }
+
+            const T& operator*() const noexcept
+            {
+                return *snapshot_;
+            }
+
+            const T* operator->() const noexcept
+            {
+                return snapshot_;
+            }
+        };
+
+        explicit RcuCell(T initial = T{})
+            : current_{new T(std::move(initial))}
+        {
+        }
+
+        RcuCell(const RcuCell&) = delete;
+        RcuCell& operator=(const RcuCell&) = delete;
+
+        ~RcuCell()
+        {
+            delete current_.load(std::memory_order_relaxed);
+        }
+
+        // snapshot stays valid (& unchanged) as long as the guard lives
+        [[nodiscard]] ReadGuard read() const noexcept
+        {
+            ReaderCounter& counter = readers_[epoch_.load(std::memory_order_seq_cst)];
+            counter.value.fetch_add(1, std::memory_order_seq_cst);
+
+            return ReadGuard{&counter, current_.load(std::memory_order_seq_cst)};
+        }
+
+        // modifier is called with the current snapshot & returns the new value of T
+        template <typename TModifier>
+        void update(TModifier modifier)
+        {
+            std::lock_guard lk{mtx_writers_};
+            publish(modifier);
+        }
+
+        // returns false (& does not call modifier) if another update is in progress
+        template <typename TModifier>
+        bool try_update(TModifier modifier)
+        {
+            std::unique_lock lk{mtx_writers_, std::try_to_lock};
+            if (!lk.owns_lock())
+                return false;
+
+            publish(modifier);
+            return true;
+        }
+
+    private:
+        template <typename TModifier>
+        void publish(TModifier& modifier)
+        {
+            const T* old_snapshot = current_.load(std::memory_order_relaxed);
+            const T* new_snapshot = new T(modifier(*old_snapshot));
+
+            current_.store(new_snapshot, std::memory_order_seq_cst);
+            synchronize();
+
+            delete old_snapshot;
+        }
+
+        // waits until readers of both epochs that could load the old snapshot are done
+        // - pairs with read(): reader does increment (store) then loads current_, writer stores current_ then loads
+        //   the counter (store-load on both sides) - all four operations must be seq_cst, so either the writer
+        //   sees the increment or the reader sees the new snapshot (acquire loads allow both to miss each other)
+        void synchronize()
+        {
+            for (int flip = 0; flip < 2; ++flip)
+            {
+                unsigned epoch = epoch_.load(std::memory_order_relaxed);
+                epoch_.store(epoch ^ 1, std::memory_order_seq_cst);
+
+                while (readers_[epoch].value.load(std::memory_order_seq_cst) != 0)
+                    std::this_thread::yield();
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,256 @@
+#include <catch2/catch_test_macros.hpp>
+#include "async_subject.hpp"
+#include "concurrent_subject.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    class RecordingObserver : public Observer
+    {
+    public:
+        std::vector<std::string> events;
+        std::vector<const std::string*> payloads;
+        std::thread::id thread_id;
+
+        void update(const std::string& event_args) override
+        {
+            events.push_back(event_args);
+            payloads.push_back(&event_args);
+            thread_id = std::this_thread::get_id();
+        }
+    };
+
+    class BlockedObserver : public Observer
+    {
+    public:
+        std::atomic<bool> is_released{false};
+        std::atomic<int> counter{0};
+
+        void update(const std::string&) override
+        {
+            while (!is_released)
+                std::this_thread::yield();
+            ++counter;
+        }
+    };
+}
+
+TEST_CASE("AsyncSubject")
+{
+    SECTION("events are delivered in order by the dispatcher thread")
+    {
+        auto observer = std::make_shared<RecordingObserver>();
+
+        AsyncSubject subject;
+        subject.register_observer(observer);
+
+        subject.set_state(1);
+        subject.set_state(2);
+        subject.set_state(2);
+        subject.set_state(3);
+        subject.flush();
+
+        CHECK(observer->events == std::vector<std::string>{"State has been set to: 1", "State has been set to: 2", "State has been set to: 3"});
+        CHECK(observer->thread_id != std::this_thread::get_id());
+    }
+
+    SECTION("payload is shared by all observers")
+    {
+        auto o1 = std::make_shared<RecordingObserver>();
+        auto o2 = std::make_shared<RecordingObserver>();
+
+        AsyncSubject subject;
+        subject.register_observer(o1);
+        subject.register_observer(o2);
+
+        subject.set_state(1);
+        subject.flush();
+
+        REQUIRE(o1->payloads.size() == 1);
+        CHECK(o1->payloads == o2->payloads);
+    }
+
+    SECTION("slow observer does not stall the producer")
+    {
+        auto slow_observer = std::make_shared<BlockedObserver>();
+        auto observer = std::make_shared<RecordingObserver>();
+
+        AsyncSubject subject{1};
+        subject.register_observer(slow_observer);
+        subject.register_observer(observer);
+
+        for (int i = 1; i <= 100; ++i)
+            subject.set_state(i); // returns although the slow observer is blocked
+
+        slow_observer->is_released = true;
+        subject.flush();
+
+        CHECK(slow_observer->counter == 100);
+        CHECK(observer->events.size() == 100);
+    }
+
+    SECTION("unregistered & expired observers are not notified")
+    {
+        auto o1 = std::make_shared<RecordingObserver>();
+        auto o2 = std::make_shared<RecordingObserver>();
+
+        AsyncSubject subject;
+        subject.register_observer(o1);
+        subject.register_observer(o2);
+        subject.set_state(1);
+        subject.flush();
+
+        subject.unregister_observer(o1);
+        o2.reset();
+        subject.set_state(2);
+        subject.flush();
+
+        CHECK(o1->events.size() == 1);
+    }
+
+    SECTION("(un)registrations & events are applied in the order of calls")
+    {
+        auto slow_observer = std::make_shared<BlockedObserver>();
+        auto observer = std::make_shared<RecordingObserver>();
+
+        AsyncSubject subject;
+        subject.register_observer(slow_observer);
+        subject.set_state(1); // dispatcher is busy with the slow observer
+
+        SECTION("observer registered after an event does not get it")
+        {
+            subject.set_state(2);
+            subject.register_observer(observer);
+            subject.set_state(3);
+
+            slow_observer->is_released = true;
+            subject.flush();
+
+            CHECK(observer->events == std::vector<std::string>{"State has been set to: 3"});
+        }
+
+        SECTION("register, unregister & register again in one batch")
+        {
+            subject.register_observer(observer);
+            subject.unregister_observer(observer);
+            subject.set_state(2);
+            subject.register_observer(observer);
+            subject.set_state(3);
+
+            slow_observer->is_released = true;
+            subject.flush();
+
+            CHECK(observer->events == std::vector<std::string>{"State has been set to: 3"});
+        }
+
+        CHECK(slow_observer->counter == 3);
+    }
+
+    SECTION("pending events are delivered before destruction")
+    {
+        auto observer = std::make_shared<RecordingObserver>();
+
+        {
+            AsyncSubject subject;
+            subject.register_observer(observer);
+
+            for (int i = 1; i <= 1'000; ++i)
+                subject.set_state(i);
+        }
+
+        CHECK(observer->events.size() == 1'000);
+        CHECK(observer->events.back() == "State has been set to: 1000");
+    }
+}
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    // state set by the producer is the index of its send time
+    class LatencyProbe : public Observer
+    {
+        const std::vector<Clock::time_point>& send_times_;
+        std::chrono::nanoseconds work_;
+
+    public:
+        std::vector<std::chrono::nanoseconds> latencies;
+
+        LatencyProbe(const std::vector<Clock::time_point>& send_times, std::chrono::nanoseconds work)
+            : send_times_{send_times}
+            , work_{work}
+        {
+            latencies.reserve(send_times.size());
+        }
+
+        void update(const std::string& event_args) override
+        {
+            constexpr std::string_view prefix = "State has been set to: ";
+            size_t index = std::stoul(event_args.substr(prefix.size()));
+
+            latencies.push_back(Clock::now() - send_times_[index]);
+
+            for (auto start = Clock::now(); Clock::now() - start < work_;) // simulated work of the observer
+            {
+            }
+        }
+    };
+
+    void print_percentiles(std::string_view name, std::chrono::nanoseconds producer_time, std::vector<std::chrono::nanoseconds> latencies)
+    {
+        std::ranges::sort(latencies);
+
+        auto percentile = [&](double p) {
+            return std::chrono::duration<double, std::micro>(latencies[static_cast<size_t>(p * (latencies.size() - 1))]).count();
+        };
+
+        std::cout << name << " - producer: " << std::chrono::duration<double, std::micro>(producer_time).count() / latencies.size()
+                  << "us/event; latency p50: " << percentile(0.5) << "us; p90: " << percentile(0.9)
+                  << "us; p99: " << percentile(0.99) << "us; max: " << percentile(1.0) << "us\n";
+    }
+}
+
+TEST_CASE("event delivery latency", "[.][benchmark]")
+{
+    constexpr int no_of_events = 10'000;
+    using namespace std::chrono_literals;
+
+    std::vector<Clock::time_point> send_times(no_of_events + 1);
+
+    auto run = [&](std::string_view name, auto& subject, auto after_publishing) {
+        auto fast_observer = std::make_shared<LatencyProbe>(send_times, 0us);
+        auto slow_observer = std::make_shared<LatencyProbe>(send_times, 20us);
+        subject.register_observer(fast_observer);
+        subject.register_observer(slow_observer);
+
+        auto start = Clock::now();
+        for (int i = 1; i <= no_of_events; ++i)
+        {
+            send_times[i] = Clock::now();
+            subject.set_state(i);
+        }
+        auto producer_time = Clock::now() - start;
+
+        after_publishing(subject);
+
+        print_percentiles(std::string{name} + " - fast observer", producer_time, fast_observer->latencies);
+        print_percentiles(std::string{name} + " - slow observer", producer_time, slow_observer->latencies);
+    };
+
+    ConcurrentSubject sync_subject;
+    run("synchronous", sync_subject, [](auto&) {});
+
+    for (size_t max_batch_size : {1, 64})
+    {
+        AsyncSubject async_subject{max_batch_size};
+        run("asynchronous - max batch: " + std::to_string(max_batch_size), async_subject, [](auto& s) { s.flush(); });
+    }
+}
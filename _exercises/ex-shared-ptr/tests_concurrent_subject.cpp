@@ -0,0 +1,370 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "concurrent_subject.hpp"
+#include "rcu_cell.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    class CountingObserver : public Observer
+    {
+    public:
+        std::atomic<int> counter{0};
+
+        void update(const std::string&) override
+        {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    class RecordingObserver : public Observer
+    {
+    public:
+        std::vector<std::string> events;
+
+        void update(const std::string& event_args) override
+        {
+            events.push_back(event_args);
+        }
+    };
+
+    // sets state of the subject from update() - nested notify
+    class ChainingObserver : public Observer
+    {
+        ConcurrentSubject& subject_;
+
+    public:
+        std::vector<std::string> events;
+
+        explicit ChainingObserver(ConcurrentSubject& subject)
+            : subject_{subject}
+        {
+        }
+
+        void update(const std::string& event_args) override
+        {
+            events.push_back(event_args);
+
+            if (events.size() == 1)
+                subject_.set_state(100);
+        }
+    };
+
+    class SilentObserver : public Observer
+    {
+    public:
+        void update(const std::string&) override
+        {
+        }
+    };
+
+    // baseline - observers protected by a mutex (notify blocks registrations & vice versa)
+    class LockedSubject
+    {
+        int state_{0};
+        std::set<std::weak_ptr<Observer>, std::owner_less<std::weak_ptr<Observer>>> observers_;
+        std::mutex mtx_;
+
+    public:
+        void register_observer(std::weak_ptr<Observer> observer)
+        {
+            std::lock_guard lk{mtx_};
+            observers_.insert(observer);
+        }
+
+        void unregister_observer(std::weak_ptr<Observer> observer)
+        {
+            std::lock_guard lk{mtx_};
+            observers_.erase(observer);
+        }
+
+        void set_state(int new_state)
+        {
+            std::lock_guard lk{mtx_};
+
+            if (state_ != new_state)
+            {
+                state_ = new_state;
+                std::string event_args = "State has been set to: " + std::to_string(state_);
+
+                for (const auto& observer : observers_)
+                    if (std::shared_ptr<Observer> living_observer = observer.lock())
+                        living_observer->update(event_args);
+            }
+        }
+    };
+}
+
+TEST_CASE("RcuCell")
+{
+    Concurrency::RcuCell<std::vector<int>> cell{{1, 2, 3}};
+
+    SECTION("read returns current snapshot")
+    {
+        CHECK(*cell.read() == std::vector{1, 2, 3});
+    }
+
+    SECTION("update publishes modified copy")
+    {
+        cell.update([](const std::vector<int>& v) {
+            auto updated = v;
+            updated.push_back(4);
+            return updated;
+        });
+
+        CHECK(*cell.read() == std::vector{1, 2, 3, 4});
+    }
+
+    SECTION("try_update publishes modified copy if no other update is in progress")
+    {
+        bool is_nested_updated{true};
+
+        bool is_updated = cell.try_update([&](const std::vector<int>& v) {
+            is_nested_updated = cell.try_update([](const std::vector<int>&) { return std::vector{42}; });
+
+            auto updated = v;
+            updated.push_back(4);
+            return updated;
+        });
+
+        CHECK(is_updated);
+        CHECK_FALSE(is_nested_updated); // writer lock is held by the outer update
+        CHECK(*cell.read() == std::vector{1, 2, 3, 4});
+    }
+
+    SECTION("snapshot held by reader is not changed by writer")
+    {
+        std::atomic<bool> is_read{false};
+        std::atomic<bool> is_updated{false};
+        bool was_updated_during_read{};
+        std::vector<int> snapshot_after_read;
+
+        std::thread reader{[&] {
+            auto snapshot = cell.read();
+            is_read = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            was_updated_during_read = is_updated;
+            snapshot_after_read = *snapshot;
+        }};
+
+        while (!is_read)
+            std::this_thread::yield();
+
+        cell.update([](const std::vector<int>&) { return std::vector{42}; });
+        is_updated = true;
+
+        reader.join();
+
+        CHECK(was_updated_during_read == false); // writer waits for the reader
+        CHECK(snapshot_after_read == std::vector{1, 2, 3});
+        CHECK(*cell.read() == std::vector{42});
+    }
+}
+
+TEST_CASE("ConcurrentSubject")
+{
+    ConcurrentSubject subject;
+
+    SECTION("observers are notified")
+    {
+        auto o1 = std::make_shared<RecordingObserver>();
+        auto o2 = std::make_shared<CountingObserver>();
+        subject.register_observer(o1);
+        subject.register_observer(o2);
+
+        subject.set_state(1);
+        subject.set_state(1);
+        subject.set_state(2);
+
+        CHECK(o1->events == std::vector<std::string>{"State has been set to: 1", "State has been set to: 2"});
+        CHECK(o2->counter == 2);
+    }
+
+    SECTION("unregistered observer is not notified")
+    {
+        auto o1 = std::make_shared<CountingObserver>();
+        auto o2 = std::make_shared<CountingObserver>();
+        subject.register_observer(o1);
+        subject.register_observer(o2);
+
+        subject.unregister_observer(o1);
+        subject.set_state(1);
+
+        CHECK(o1->counter == 0);
+        CHECK(o2->counter == 1);
+        CHECK(subject.no_of_observers() == 1);
+    }
+
+    SECTION("expired observers are pruned")
+    {
+        auto o1 = std::make_shared<CountingObserver>();
+        subject.register_observer(o1);
+
+        {
+            auto temp = std::make_shared<CountingObserver>();
+            subject.register_observer(temp);
+        }
+
+        CHECK(subject.no_of_observers() == 2);
+
+        subject.set_state(1);
+        subject.prune();
+
+        CHECK(subject.no_of_observers() == 1);
+
+        SECTION("also by registration")
+        {
+            {
+                auto temp = std::make_shared<CountingObserver>();
+                subject.register_observer(temp);
+            }
+
+            auto o2 = std::make_shared<CountingObserver>();
+            subject.register_observer(o2);
+
+            CHECK(subject.no_of_observers() == 2);
+        }
+    }
+
+    SECTION("expired observers are pruned by notify")
+    {
+        auto o1 = std::make_shared<CountingObserver>();
+        subject.register_observer(o1);
+
+        {
+            auto temp = std::make_shared<CountingObserver>();
+            subject.register_observer(temp);
+        }
+
+        subject.set_state(1);
+
+        CHECK(o1->counter == 1);
+        CHECK(subject.no_of_observers() == 1);
+    }
+
+    SECTION("nested notify from update() - pruning is left to the outer notify")
+    {
+        auto o1 = std::make_shared<ChainingObserver>(subject);
+        subject.register_observer(o1);
+
+        {
+            auto temp = std::make_shared<CountingObserver>();
+            subject.register_observer(temp);
+        }
+
+        subject.set_state(1); // would deadlock if the nested notify pruned while the outer one holds the snapshot
+
+        CHECK(o1->events == std::vector<std::string>{"State has been set to: 1", "State has been set to: 100"});
+        CHECK(subject.no_of_observers() == 1);
+    }
+
+    SECTION("notify concurrently with registrations")
+    {
+        constexpr int no_of_events = 10'000;
+
+        auto stable_observer = std::make_shared<CountingObserver>();
+        subject.register_observer(stable_observer);
+
+        std::atomic<bool> is_done{false};
+
+        std::thread churn{[&] {
+            while (!is_done)
+            {
+                auto temp = std::make_shared<SilentObserver>();
+                subject.register_observer(temp);
+                subject.unregister_observer(temp);
+            }
+        }};
+
+        std::vector<std::thread> notifiers;
+        for (int t = 0; t < 2; ++t)
+            notifiers.emplace_back([&, t] {
+                for (int i = 1; i <= no_of_events; ++i)
+                    subject.set_state(t % 2 == 0 ? i : -i); // states are different for each thread
+            });
+
+        for (auto& thd : notifiers)
+            thd.join();
+
+        is_done = true;
+        churn.join();
+
+        CHECK(stable_observer->counter >= no_of_events);
+        CHECK(subject.no_of_observers() == 1);
+    }
+}
+
+TEST_CASE("notify throughput under concurrent churn", "[.][benchmark]")
+{
+    constexpr int no_of_observers = 1'000;
+    constexpr int no_of_events = 100;
+
+    std::vector<std::shared_ptr<Observer>> observers;
+    for (int i = 0; i < no_of_observers; ++i)
+        observers.push_back(std::make_shared<SilentObserver>());
+
+    auto run_with_churn = [&](auto& subject, int no_of_churn_threads, auto notify_loop) {
+        std::atomic<bool> is_done{false};
+        std::vector<std::thread> churn_threads;
+
+        for (int t = 0; t < no_of_churn_threads; ++t)
+            churn_threads.emplace_back([&] {
+                while (!is_done.load(std::memory_order_relaxed))
+                {
+                    auto temp = std::make_shared<SilentObserver>();
+                    subject.register_observer(temp);
+                    subject.unregister_observer(temp);
+                }
+            });
+
+        auto result = notify_loop();
+
+        is_done = true;
+        for (auto& thd : churn_threads)
+            thd.join();
+
+        return result;
+    };
+
+    for (int no_of_churn_threads : {0, 1, 2})
+    {
+        const std::string suffix = " - churn threads: " + std::to_string(no_of_churn_threads);
+
+        ConcurrentSubject concurrent_subject;
+        LockedSubject locked_subject;
+        for (const auto& o : observers)
+        {
+            concurrent_subject.register_observer(o);
+            locked_subject.register_observer(o);
+        }
+
+        BENCHMARK_ADVANCED("LockedSubject" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            run_with_churn(locked_subject, no_of_churn_threads, [&] {
+                meter.measure([&](int run) {
+                    for (int i = 0; i < no_of_events; ++i)
+                        locked_subject.set_state(run * no_of_events + i + 1);
+                });
+                return 0;
+            });
+        };
+
+        BENCHMARK_ADVANCED("ConcurrentSubject" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            run_with_churn(concurrent_subject, no_of_churn_threads, [&] {
+                meter.measure([&](int run) {
+                    for (int i = 0; i < no_of_events; ++i)
+                        concurrent_subject.set_state(run * no_of_events + i + 1);
+                });
+                return 0;
+            });
+        };
+    }
+}
@@ -0,0 +1,255 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "allocation_counter.hpp"
+#include "concurrent_subject.hpp"
+#include "typed_subject.hpp"
+#include <any>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace
+{
+    class StateRecorder : public TypedObserver<Events::Event>
+    {
+    public:
+        std::vector<int> states;
+        bool is_closed = false;
+
+        void update(const Events::Event& event) override
+        {
+            if (const auto* state_changed = std::get_if<Events::StateChanged>(&event))
+                states.push_back(state_changed->new_state);
+            else if (std::holds_alternative<Events::Closed>(event))
+                is_closed = true;
+        }
+    };
+
+    // unregisters itself on the first event
+    class OneShotObserver : public TypedObserver<Events::Event>, public std::enable_shared_from_this<OneShotObserver>
+    {
+        StateSubject& subject_;
+
+    public:
+        int counter = 0;
+
+        explicit OneShotObserver(StateSubject& subject)
+            : subject_{subject}
+        {
+        }
+
+        void update(const Events::Event&) override
+        {
+            ++counter;
+            subject_.unregister_observer(weak_from_this());
+        }
+    };
+
+    class StateSum : public TypedObserver<Events::Event>
+    {
+    public:
+        long sum = 0;
+
+        void update(const Events::Event& event) override
+        {
+            std::visit([this](const auto& e) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(e)>, Events::StateChanged>)
+                    sum += e.new_state - e.old_state;
+            }, event);
+        }
+    };
+
+    // payloads used by the string & std::any observer channels
+    class StringSink : public Observer
+    {
+    public:
+        size_t length = 0;
+
+        void update(const std::string& event_args) override
+        {
+            length += event_args.size();
+        }
+    };
+
+    class AnyObserver
+    {
+    public:
+        virtual void update(const std::any& event_args) = 0;
+        virtual ~AnyObserver() = default;
+    };
+
+    class AnySink : public AnyObserver
+    {
+    public:
+        size_t length = 0;
+
+        void update(const std::any& event_args) override
+        {
+            length += std::any_cast<const std::string&>(event_args).size();
+        }
+    };
+
+    class AnySubject
+    {
+        int state_{0};
+        std::vector<std::weak_ptr<AnyObserver>> observers_;
+
+    public:
+        void register_observer(std::weak_ptr<AnyObserver> observer)
+        {
+            observers_.push_back(std::move(observer));
+        }
+
+        void set_state(int new_state)
+        {
+            if (state_ != new_state)
+            {
+                state_ = new_state;
+
+                std::any event_args = "State has been set to: " + std::to_string(state_);
+                for (const auto& observer : observers_)
+                    if (auto living_observer = observer.lock())
+                        living_observer->update(event_args);
+            }
+        }
+    };
+}
+
+TEST_CASE("TypedSubject")
+{
+    StateSubject subject;
+    auto recorder = std::make_shared<StateRecorder>();
+    subject.register_observer(recorder);
+
+    SECTION("observers receive typed events")
+    {
+        subject.set_state(1);
+        subject.set_state(1);
+        subject.set_state(42);
+        subject.close();
+
+        CHECK(recorder->states == std::vector{1, 42});
+        CHECK(recorder->is_closed);
+    }
+
+    SECTION("event carries old & new state")
+    {
+        auto sum = std::make_shared<StateSum>();
+        subject.register_observer(sum);
+
+        subject.set_state(10);
+        subject.set_state(3);
+
+        CHECK(sum->sum == 3);
+    }
+
+    SECTION("unregistered observer is not notified")
+    {
+        subject.unregister_observer(recorder);
+        subject.set_state(1);
+
+        CHECK(recorder->states.empty());
+    }
+
+    SECTION("observer may unregister itself from update - next observer is not skipped")
+    {
+        StateSubject other_subject;
+        auto one_shot = std::make_shared<OneShotObserver>(other_subject);
+        other_subject.register_observer(one_shot);
+        other_subject.register_observer(recorder);
+
+        other_subject.set_state(1);
+        other_subject.set_state(2);
+
+        CHECK(one_shot->counter == 1);
+        CHECK(recorder->states == std::vector{1, 2});
+        CHECK(other_subject.no_of_observers() == 1);
+    }
+
+    SECTION("expired observers are removed by notify")
+    {
+        {
+            auto temp = std::make_shared<StateRecorder>();
+            subject.register_observer(temp);
+        }
+
+        CHECK(subject.no_of_observers() == 2);
+
+        subject.set_state(1);
+
+        CHECK(subject.no_of_observers() == 1);
+    }
+
+    SECTION("notify does not allocate")
+    {
+        subject.unregister_observer(recorder); // records states in std::vector
+        subject.register_observer(std::make_shared<StateSum>()); // expired - removed in place
+        auto sum = std::make_shared<StateSum>();
+        subject.register_observer(sum);
+
+        size_t allocations = allocations_during([&] {
+            for (int i = 1; i <= 1'000; ++i)
+                subject.set_state(i);
+            subject.close();
+        });
+
+        CHECK(allocations == 0);
+        CHECK(sum->sum == 1'000);
+    }
+}
+
+TEST_CASE("allocations per notify", "[.][benchmark]")
+{
+    constexpr int no_of_observers = 10;
+    constexpr int no_of_events = 1'000;
+
+    ConcurrentSubject string_subject;
+    AnySubject any_subject;
+    StateSubject typed_subject;
+
+    std::vector<std::shared_ptr<void>> observers;
+    for (int i = 0; i < no_of_observers; ++i)
+    {
+        auto string_sink = std::make_shared<StringSink>();
+        auto any_sink = std::make_shared<AnySink>();
+        auto state_sum = std::make_shared<StateSum>();
+
+        string_subject.register_observer(string_sink);
+        any_subject.register_observer(any_sink);
+        typed_subject.register_observer(state_sum);
+
+        observers.insert(observers.end(), {string_sink, any_sink, state_sum});
+    }
+
+    auto events = [](auto& subject) {
+        return [&subject] {
+            for (int i = 1; i <= no_of_events; ++i)
+                subject.set_state(i * 1'000'000); // long enough to defeat SSO of std::string
+            subject.set_state(0);
+        };
+    };
+
+    auto per_notify = [&](size_t allocations) { return static_cast<double>(allocations) / (no_of_events + 1); };
+
+    std::cout << "Allocations per notify (" << no_of_observers << " observers)"
+              << " - std::string: " << per_notify(allocations_during(events(string_subject)))
+              << ", std::any: " << per_notify(allocations_during(events(any_subject)))
+              << ", typed: " << per_notify(allocations_during(events(typed_subject))) << "\n";
+
+    BENCHMARK("std::string events")
+    {
+        events(string_subject)();
+    };
+
+    BENCHMARK("std::any events")
+    {
+        events(any_subject)();
+    };
+
+    BENCHMARK("typed events")
+    {
+        events(typed_subject)();
+    };
+}
@@ -0,0 +1,139 @@
+#ifndef TYPED_SUBJECT_HPP
+#define TYPED_SUBJECT_HPP
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Observer channel for events of type TEvent - events are passed by const reference,
+// so delivering a trivially copyable event (or a variant of such events) never allocates
+template <typename TEvent>
+class TypedObserver
+{
+public:
+    virtual void update(const TEvent& event) = 0;
+    virtual ~TypedObserver() = default;
+};
+
+// - expired observers are removed during notify() (in place - no allocation)
+// - observers may (un)register from update() - the list is iterated by index & an observer unregistered
+//   during notify() is only reset (list is compacted after the loop, so no observer is skipped)
+template <typename TEvent>
+class TypedSubject
+{
+public:
+    using event_type = TEvent;
+    using observer_type = TypedObserver<TEvent>;
+
+private:
+    std::vector<std::weak_ptr<observer_type>> observers_;
+    bool is_notifying_{false};
+    bool has_expired_observers_{false};
+
+    static bool is_same_observer(const std::weak_ptr<observer_type>& a, const std::weak_ptr<observer_type>& b)
+    {
+        return !a.owner_before(b) && !b.owner_before(a);
+    }
+
+public:
+    void register_observer(std::weak_ptr<observer_type> observer)
+    {
+        observers_.push_back(std::move(observer));
+    }
+
+    void unregister_observer(const std::weak_ptr<observer_type>& observer)
+    {
+        if (!is_notifying_)
+        {
+            std::erase_if(observers_, [&](const auto& o) { return is_same_observer(o, observer); });
+            return;
+        }
+
+        for (auto& o : observers_)
+        {
+            if (is_same_observer(o, observer))
+            {
+                o.reset(); // removed after the loop in notify()
+                has_expired_observers_ = true;
+            }
+        }
+    }
+
+    size_t no_of_observers() const
+    {
+        return observers_.size();
+    }
+
+protected:
+    void notify(const TEvent& event)
+    {
+        struct NotifyScope // restores the flag also when update() throws (nested notify() does not compact)
+        {
+            TypedSubject& subject;
+            bool is_outermost = !std::exchange(subject.is_notifying_, true);
+
+            ~NotifyScope()
+            {
+                if (!is_outermost)
+                    return;
+
+                subject.is_notifying_ = false;
+
+                if (std::exchange(subject.has_expired_observers_, false))
+                    std::erase_if(subject.observers_, [](const auto& o) { return o.expired(); });
+            }
+        } scope{*this};
+
+        for (size_t i = 0; i < observers_.size(); ++i)
+        {
+            if (std::shared_ptr<observer_type> living_observer = observers_[i].lock())
+                living_observer->update(event);
+            else
+                has_expired_observers_ = true;
+        }
+    }
+};
+
+namespace Events
+{
+    struct StateChanged
+    {
+        int old_state;
+        int new_state;
+    };
+
+    struct Closed
+    {
+    };
+
+    // all kinds of events sent by StateSubject - stored inline (no heap allocation)
+    using Event = std::variant<StateChanged, Closed>;
+}
+
+class StateSubject : public TypedSubject<Events::Event>
+{
+    int state_{0};
+
+public:
+    int state() const
+    {
+        return state_;
+    }
+
+    void set_state(int new_state)
+    {
+        if (state_ != new_state)
+        {
+            notify(Events::StateChanged{std::exchange(state_, new_state), new_state});
+        }
+    }
+
+    void close()
+    {
+        notify(Events::Closed{});
+    }
+};
+
+#endif
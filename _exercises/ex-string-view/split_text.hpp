@@ -0,0 +1,219 @@
+#ifndef SPLIT_TEXT_HPP
+#define SPLIT_TEXT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace Text
+{
+    // set of single-byte delimiters:
+    // - up to max_simd_size delimiters are compared against 32/16 bytes of text at once
+    // - bigger sets (and the tails of the text) are checked with a 256-bit lookup table
+    class DelimiterSet
+    {
+    public:
+        static constexpr size_t max_simd_size = 16;
+
+    private:
+        std::array<uint64_t, 4> table_{};
+        std::array<char, max_simd_size> chars_{};
+        size_t size_{0};
+
+    public:
+        constexpr DelimiterSet(std::string_view delimiters)
+        {
+            for (char c : delimiters)
+            {
+                if (contains(c))
+                    continue;
+
+                auto byte = static_cast<unsigned char>(c);
+                table_[byte / 64] |= uint64_t{1} << (byte % 64);
+
+                if (size_ < max_simd_size)
+                    chars_[size_] = c;
+                ++size_;
+            }
+        }
+
+        constexpr bool contains(char c) const
+        {
+            auto byte = static_cast<unsigned char>(c);
+            return (table_[byte / 64] >> (byte % 64)) & 1;
+        }
+
+        // returns pointer to the first delimiter in [first, last) or last
+        const char* find_in(const char* first, const char* last) const
+        {
+            if (size_ == 0)
+                return last;
+
+            if (size_ <= max_simd_size)
+                first = find_simd(first, last);
+
+            return std::find_if(first, last, [this](char c) { return contains(c); });
+        }
+
+        // returns pointer to the first non-delimiter in [first, last) or last
+        const char* skip_in(const char* first, const char* last) const
+        {
+            return std::find_if_not(first, last, [this](char c) { return contains(c); }); // runs are usually short
+        }
+
+    private:
+        // scans whole blocks - returns position of the first delimiter or the start of the unscanned tail
+        const char* find_simd(const char* first, const char* last) const
+        {
+#if defined(__AVX2__)
+            for (; last - first >= 32; first += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+                __m256i hits = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(chars_[0]));
+
+                for (size_t i = 1; i < size_; ++i)
+                    hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(chars_[i])));
+
+                if (uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(hits)))
+                    return first + std::countr_zero(mask);
+            }
+#elif defined(__SSE4_2__)
+            const __m128i delimiters = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars_.data()));
+            const int no_of_delimiters = static_cast<int>(size_);
+
+            for (; last - first >= 16; first += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                int index = _mm_cmpestri(delimiters, no_of_delimiters, block, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+
+                if (index < 16)
+                    return first + index;
+            }
+#elif defined(__SSE2__) || defined(_M_X64)
+            for (; last - first >= 16; first += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                __m128i hits = _mm_cmpeq_epi8(block, _mm_set1_epi8(chars_[0]));
+
+                for (size_t i = 1; i < size_; ++i)
+                    hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, _mm_set1_epi8(chars_[i])));
+
+                if (uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(hits)))
+                    return first + std::countr_zero(mask);
+            }
+#endif
+            return first;
+        }
+    };
+
+    // Lazy range of tokens (std::string_view) separated by any of the delimiters:
+    // - no copies & no allocations - tokens point into the original text
+    // - empty tokens (between adjacent delimiters) are skipped
+    // - the text must outlive the view; iterators refer to the view
+    class SplitTextView : public std::ranges::view_interface<SplitTextView>
+    {
+        std::string_view text_;
+        DelimiterSet delimiters_;
+
+    public:
+        class iterator
+        {
+            const SplitTextView* view_{nullptr};
+            std::string_view token_{};
+
+        public:
+            using iterator_category = std::input_iterator_tag; // reference is not a real reference
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::string_view;
+            using pointer = void;
+
+            iterator() = default;
+
+            iterator(const SplitTextView* view, const char* position)
+                : view_{view}
+            {
+                find_token(position);
+            }
+
+            std::string_view operator*() const
+            {
+                return token_;
+            }
+
+            iterator& operator++()
+            {
+                find_token(token_.data() + token_.size());
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator temp{*this};
+                ++*this;
+                return temp;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return token_.data() == other.token_.data();
+            }
+
+        private:
+            void find_token(const char* position)
+            {
+                const char* text_end = view_->text_.data() + view_->text_.size();
+                const char* token_begin = view_->delimiters_.skip_in(position, text_end);
+
+                if (token_begin == text_end)
+                {
+                    token_ = {}; // end
+                    return;
+                }
+
+                const char* token_end = view_->delimiters_.find_in(token_begin, text_end);
+                token_ = std::string_view(token_begin, token_end - token_begin);
+            }
+        };
+
+        SplitTextView(std::string_view text, std::string_view delimiters)
+            : text_{text}
+            , delimiters_{delimiters}
+        {
+        }
+
+        iterator begin() const
+        {
+            return iterator{this, text_.data()};
+        }
+
+        iterator end() const
+        {
+            return iterator{};
+        }
+
+        // materializes all tokens (the only operation that allocates)
+        operator std::vector<std::string_view>() const
+        {
+            return std::vector<std::string_view>(begin(), end());
+        }
+    };
+
+    inline SplitTextView split_text(std::string_view text, std::string_view delimiters = " ,")
+    {
+        return SplitTextView{text, delimiters};
+    }
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <catch2/catch_test_macros.hpp>
+#include "split_text.hpp"
 #include <iostream>
 #include <set>
 #include <string>
@@ -8,26 +9,26 @@
 
 using namespace std;
 
-// TODO
+using Text::split_text;
 
-// TEST_CASE("split with spaces")
-// {
-//     const char* text = "one two three four";
+TEST_CASE("split with spaces")
+{
+    const char* text = "one two three four";
 
-//     std::vector<std::string_view> words = split_text(text);
+    std::vector<std::string_view> words = split_text(text);
 
-//     auto expected = {"one", "two", "three", "four"};
+    auto expected = {"one", "two", "three", "four"};
 
-//     REQUIRE(equal(begin(expected), end(expected), begin(words)));
-// }
+    REQUIRE(equal(begin(expected), end(expected), begin(words)));
+}
 
-// TEST_CASE("split with commas")
-// {
-//     string text = "one,two,three,four";
+TEST_CASE("split with commas")
+{
+    string text = "one,two,three,four";
 
-//     auto words = split_text(text);
+    auto words = split_text(text);
 
-//     auto expected = {"one", "two", "three", "four"};
+    auto expected = {"one", "two", "three", "four"};
 
-//     REQUIRE(equal(begin(expected), end(expected), begin(words)));
-// }
+    REQUIRE(equal(begin(expected), end(expected), begin(words)));
+}
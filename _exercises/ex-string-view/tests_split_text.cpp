@@ -0,0 +1,183 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "split_text.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    // reference implementation - std::string_view::find_first_of loop
+    std::vector<std::string_view> split_with_find(std::string_view text, std::string_view delimiters)
+    {
+        std::vector<std::string_view> tokens;
+
+        for (size_t start = text.find_first_not_of(delimiters); start != std::string_view::npos;
+             start = text.find_first_not_of(delimiters, start))
+        {
+            size_t end = std::min(text.find_first_of(delimiters, start), text.size());
+            tokens.push_back(text.substr(start, end - start));
+            start = end;
+        }
+
+        return tokens;
+    }
+
+    std::string generate_log(size_t size, unsigned seed = 42)
+    {
+        const std::vector<std::string_view> words = {"INFO", "WARN", "ERROR", "request", "id=4711", "user,admin", "latency;17ms",
+            "GET", "/api/v1/items", "200", "connection-reset", "timeout", "retrying", "shard:3"};
+
+        std::mt19937 rnd{seed};
+        std::uniform_int_distribution<size_t> word_distr{0, words.size() - 1};
+        std::uniform_int_distribution<int> line_distr{0, 11};
+
+        std::string log;
+        log.reserve(size + 64);
+
+        while (log.size() < size)
+        {
+            log += words[word_distr(rnd)];
+            log += line_distr(rnd) == 0 ? '\n' : ' ';
+        }
+
+        return log;
+    }
+}
+
+TEST_CASE("split_text")
+{
+    using Text::split_text;
+
+    SECTION("is lazy view over the text")
+    {
+        std::string_view text = "alpha beta";
+        auto tokens = split_text(text);
+
+        auto it = tokens.begin();
+        CHECK(*it == "alpha");
+        CHECK((*it).data() == text.data());
+        ++it;
+        CHECK(*it == "beta");
+        ++it;
+        CHECK(it == tokens.end());
+    }
+
+    SECTION("empty tokens are skipped")
+    {
+        std::vector<std::string_view> tokens = split_text(",, one,,two  ,three,", " ,");
+
+        CHECK(tokens == std::vector{"one"sv, "two"sv, "three"sv});
+    }
+
+    SECTION("empty text & text of delimiters only")
+    {
+        CHECK(std::ranges::distance(split_text("")) == 0);
+        CHECK(std::ranges::distance(split_text(" , ,")) == 0);
+    }
+
+    SECTION("text without delimiters")
+    {
+        CHECK(std::vector<std::string_view>(split_text("token")) == std::vector{"token"sv});
+    }
+
+    SECTION("multi-char delimiter set")
+    {
+        std::vector<std::string_view> tokens = split_text("a=1;b=2|c=3", ";|=");
+
+        CHECK(tokens == std::vector{"a"sv, "1"sv, "b"sv, "2"sv, "c"sv, "3"sv});
+    }
+
+    SECTION("delimiter set bigger than SIMD register")
+    {
+        std::string delimiters = "!\"#$%&'()*+,-./:;<=>?@[\\\\]^_`{|}~ "; // scanned with lookup table only
+        REQUIRE(delimiters.size() > Text::DelimiterSet::max_simd_size);
+
+        std::vector<std::string_view> tokens = split_text("one!two~three{four", delimiters);
+
+        CHECK(tokens == std::vector{"one"sv, "two"sv, "three"sv, "four"sv});
+    }
+
+    SECTION("bytes above 127 & zero bytes")
+    {
+        std::string text = "a\xff"s + "b\0c"s + "\xff";
+
+        CHECK(std::vector<std::string_view>(split_text(text, "\xff")) == std::vector{"a"sv, "b\0c"sv});
+        CHECK(std::vector<std::string_view>(split_text(text, "\0"sv)) == std::vector{"a\xff" "b"sv, "c\xff"sv});
+    }
+
+    SECTION("long text gives the same tokens as find loop")
+    {
+        std::string log = generate_log(100'000);
+
+        for (std::string_view delimiters : {" "sv, " \n"sv, " \n,;:"sv, "abcdefghijklmnopqrstuvwxyz"sv})
+        {
+            INFO("delimiters: " << delimiters);
+            CHECK(std::vector<std::string_view>(split_text(log, delimiters)) == split_with_find(log, delimiters));
+        }
+
+        for (size_t offset = 0; offset < 64; ++offset) // tokens crossing block boundaries at every alignment
+        {
+            std::string_view text = std::string_view{log}.substr(offset, 1'000);
+            CHECK(std::vector<std::string_view>(split_text(text, " \n")) == split_with_find(text, " \n"));
+        }
+    }
+}
+
+TEST_CASE("split_text throughput", "[.][benchmark]")
+{
+    const std::string log = generate_log(64 * 1024 * 1024);
+
+    auto count_with_find = [&log](std::string_view delimiters) {
+        std::string_view text = log;
+        size_t no_of_tokens = 0;
+
+        for (size_t start = text.find_first_not_of(delimiters); start != std::string_view::npos;
+             start = text.find_first_not_of(delimiters, start))
+        {
+            start = std::min(delimiters.size() == 1 ? text.find(delimiters[0], start) : text.find_first_of(delimiters, start), text.size());
+            ++no_of_tokens;
+        }
+
+        return no_of_tokens;
+    };
+
+    auto count_with_split_text = [&log](std::string_view delimiters) {
+        size_t no_of_tokens = 0;
+        for ([[maybe_unused]] std::string_view token : Text::split_text(log, delimiters))
+            ++no_of_tokens;
+        return no_of_tokens;
+    };
+
+    auto print_throughput = [&log](std::string_view name, auto count_tokens) {
+        auto start = std::chrono::steady_clock::now();
+        size_t no_of_tokens = count_tokens();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << name << ": " << log.size() / elapsed.count() / 1e9 << " GB/s (" << no_of_tokens << " tokens)\n";
+    };
+
+    for (std::string_view delimiters : {" "sv, " \n,;"sv})
+    {
+        const std::string suffix = " - delimiters: " + std::to_string(delimiters.size());
+
+        print_throughput("string_view::find loop" + suffix, [&] { return count_with_find(delimiters); });
+        print_throughput("split_text" + suffix, [&] { return count_with_split_text(delimiters); });
+
+        BENCHMARK("string_view::find loop" + suffix)
+        {
+            return count_with_find(delimiters);
+        };
+
+        BENCHMARK("split_text" + suffix)
+        {
+            return count_with_split_text(delimiters);
+        };
+    }
+}
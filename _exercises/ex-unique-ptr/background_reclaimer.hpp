@@ -0,0 +1,113 @@
+#ifndef BACKGROUND_RECLAIMER_HPP
+#define BACKGROUND_RECLAIMER_HPP
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace ModernCpp
+{
+    // Thread that destroys retired objects (e.g. whole node chains with their pools) in the background,
+    // so the owner's destructor/clear() returns in O(1)
+    class BackgroundReclaimer
+    {
+        struct Garbage
+        {
+            virtual ~Garbage() = default;
+        };
+
+        template <typename T>
+        struct GarbageOf : Garbage
+        {
+            T object;
+
+            explicit GarbageOf(T&& obj)
+                : object{std::move(obj)}
+            {
+            }
+        };
+
+        std::queue<std::unique_ptr<Garbage>> garbage_;
+        std::mutex mtx_;
+        std::condition_variable cv_garbage_;
+        std::condition_variable cv_empty_;
+        size_t in_progress_{0};
+        bool done_{false};
+        std::thread thd_;
+
+    public:
+        BackgroundReclaimer()
+            : thd_{[this] { run(); }}
+        {
+        }
+
+        BackgroundReclaimer(const BackgroundReclaimer&) = delete;
+        BackgroundReclaimer& operator=(const BackgroundReclaimer&) = delete;
+
+        // all retired objects are destroyed before the thread is joined
+        ~BackgroundReclaimer()
+        {
+            {
+                std::lock_guard lk{mtx_};
+                done_ = true;
+            }
+            cv_garbage_.notify_one();
+            thd_.join();
+        }
+
+        // object will be destroyed by the background thread
+        template <typename T>
+        void retire(T&& object)
+        {
+            auto garbage = std::make_unique<GarbageOf<std::decay_t<T>>>(std::forward<T>(object));
+
+            {
+                std::lock_guard lk{mtx_};
+                garbage_.push(std::move(garbage));
+            }
+            cv_garbage_.notify_one();
+        }
+
+        // blocks until all retired objects are destroyed
+        void wait()
+        {
+            std::unique_lock lk{mtx_};
+            cv_empty_.wait(lk, [this] { return garbage_.empty() && in_progress_ == 0; });
+        }
+
+    private:
+        void run()
+        {
+            while (true)
+            {
+                std::unique_ptr<Garbage> garbage;
+
+                {
+                    std::unique_lock lk{mtx_};
+                    cv_garbage_.wait(lk, [this] { return done_ || !garbage_.empty(); });
+
+                    if (garbage_.empty())
+                        return;
+
+                    garbage = std::move(garbage_.front());
+                    garbage_.pop();
+                    ++in_progress_;
+                }
+
+                garbage.reset();
+
+                {
+                    std::lock_guard lk{mtx_};
+                    --in_progress_;
+                }
+                cv_empty_.notify_all();
+            }
+        }
+    };
+}
+
+#endif
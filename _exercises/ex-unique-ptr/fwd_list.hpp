@@ -1,8 +1,17 @@
 #ifndef FWD_LIST_HPP
 #define FWD_LIST_HPP
 
+#include "background_reclaimer.hpp"
+#include "node_pool.hpp"
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace LegacyCode
 {
@@ -94,10 +103,448 @@ namespace LegacyCode
 
 namespace ModernCpp
 {
+    // Nodes are owned by the list & recycled by NodePool:
+    // - by default every list has its own pool (allocated with std::unique_ptr)
+    // - lists used by the same thread may share a pool passed to the constructor
+    // - destruction is iterative (no recursion like in the chain of std::unique_ptr<Node>)
+    //   & the whole chain of nodes is returned to the pool in one batch
     template <typename T>
     class FwdList
     {
-        // TODO: use std::unique_ptr & implement FwdList
+    public:
+        using value_type = T;
+        using pool_type = NodePool<T>;
+
+    private:
+        using Node = typename pool_type::Node;
+
+        template <typename TValue>
+        class Iterator
+        {
+            Node* node_;
+
+            friend class FwdList;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = TValue*;
+            using reference = TValue&;
+
+            explicit Iterator(Node* node = nullptr) noexcept
+                : node_{node}
+            {
+            }
+
+            operator Iterator<const T>() const noexcept requires (!std::is_const_v<TValue>)
+            {
+                return Iterator<const T>{node_};
+            }
+
+            reference operator*() const
+            {
+                return node_->value;
+            }
+
+            pointer operator->() const
+            {
+                return &node_->value;
+            }
+
+            Iterator& operator++()
+            {
+                node_ = node_->next;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator temp{*this};
+                node_ = node_->next;
+                return temp;
+            }
+
+            bool operator==(const Iterator& other) const = default;
+        };
+
+    public:
+        using iterator = Iterator<T>;
+        using const_iterator = Iterator<const T>;
+
+        FwdList()
+            : own_pool_{std::make_unique<pool_type>()}
+            , pool_{own_pool_.get()}
+        {
+        }
+
+        explicit FwdList(pool_type& shared_pool)
+            : pool_{&shared_pool}
+        {
+        }
+
+        FwdList(const FwdList&) = delete;
+        FwdList& operator=(const FwdList&) = delete;
+
+        FwdList(FwdList&& other) noexcept
+            : own_pool_{std::move(other.own_pool_)}
+            , pool_{other.pool_}
+            , head_{std::exchange(other.head_, nullptr)}
+            , tail_{std::exchange(other.tail_, nullptr)}
+            , size_{std::exchange(other.size_, 0)}
+        {
+            if (own_pool_)
+                other.pool_ = nullptr; // the pool is owned by this list now
+        }
+
+        FwdList& operator=(FwdList&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+
+                own_pool_ = std::move(other.own_pool_);
+                pool_ = other.pool_;
+                head_ = std::exchange(other.head_, nullptr);
+                tail_ = std::exchange(other.tail_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+                if (own_pool_)
+                    other.pool_ = nullptr;
+            }
+
+            return *this;
+        }
+
+        ~FwdList()
+        {
+            clear();
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        T& front()
+        {
+            assert(head_ != nullptr);
+            return head_->value;
+        }
+
+        const T& front() const
+        {
+            assert(head_ != nullptr);
+            return head_->value;
+        }
+
+        void push_front(const T& item)
+        {
+            emplace_front(item);
+        }
+
+        void push_front(T&& item)
+        {
+            emplace_front(std::move(item));
+        }
+
+        template <typename... TArgs>
+        T& emplace_front(TArgs&&... args)
+        {
+            Node* new_node = acquire_pool().allocate();
+
+            try
+            {
+                new (&new_node->value) T(std::forward<TArgs>(args)...);
+            }
+            catch (...)
+            {
+                pool_->deallocate(new_node);
+                throw;
+            }
+
+            new_node->next = head_;
+            head_ = new_node;
+            if (!tail_)
+                tail_ = new_node;
+            ++size_;
+
+            return new_node->value;
+        }
+
+        void pop_front()
+        {
+            assert(size_ != 0);
+
+            Node* node_to_pop = std::exchange(head_, head_->next);
+            if (!head_)
+                tail_ = nullptr;
+
+            std::destroy_at(&node_to_pop->value);
+            pool_->deallocate(node_to_pop);
+            --size_;
+        }
+
+        // O(1) for trivially destructible items, otherwise one loop destroying items
+        void clear() noexcept
+        {
+            if (!head_)
+                return;
+
+            destroy_values(head_);
+            pool_->deallocate_chain(head_, tail_);
+
+            head_ = tail_ = nullptr;
+            size_ = 0;
+        }
+
+        // O(1) - items & nodes are handed over to the reclaimer thread together with the list's own pool
+        // (list with shared pool is cleared synchronously - the pool must not be used by other thread)
+        void clear_async(BackgroundReclaimer& reclaimer)
+        {
+            if (!head_)
+                return;
+
+            if (!own_pool_ || std::is_trivially_destructible_v<T>)
+            {
+                clear();
+                return;
+            }
+
+            auto new_pool = std::make_unique<pool_type>();
+            reclaimer.retire(RetiredChain{std::exchange(own_pool_, std::move(new_pool)), std::exchange(head_, nullptr)});
+            pool_ = own_pool_.get();
+            tail_ = nullptr;
+            size_ = 0;
+        }
+
+        // moves all items from other to the front of the list in O(1) - nodes are relinked, not copied
+        // (both lists must share the same pool - std::invalid_argument is thrown otherwise; empty other is a no-op)
+        void splice_front(FwdList& other)
+        {
+            if (other.empty())
+                return;
+
+            check_same_pool(other);
+
+            other.tail_->next = head_;
+            if (!tail_)
+                tail_ = other.tail_;
+            head_ = other.head_;
+            size_ += other.size_;
+
+            other.release_nodes();
+        }
+
+        // moves all items from other after pos in O(1) (both lists must share the same pool)
+        void splice_after(const_iterator pos, FwdList& other)
+        {
+            assert(pos.node_ != nullptr);
+
+            if (other.empty())
+                return;
+
+            check_same_pool(other);
+
+            other.tail_->next = pos.node_->next;
+            pos.node_->next = other.head_;
+            if (pos.node_ == tail_)
+                tail_ = other.tail_;
+            size_ += other.size_;
+
+            other.release_nodes();
+        }
+
+        // appends all items from other in O(1) (both lists must share the same pool)
+        void splice_back(FwdList& other)
+        {
+            if (empty())
+                splice_front(other);
+            else
+                splice_after(const_iterator{tail_}, other);
+        }
+
+        void reverse() noexcept
+        {
+            Node* reversed = nullptr;
+            tail_ = head_;
+
+            while (head_)
+            {
+                Node* node = std::exchange(head_, head_->next);
+                node->next = reversed;
+                reversed = node;
+            }
+
+            head_ = reversed;
+        }
+
+        // stable bottom-up merge sort - O(n log n), no allocations, items are neither copied nor moved
+        // - bins[i] holds sorted run of 2^i nodes (runs in higher bins contain earlier items)
+        template <typename TCompare = std::less<>>
+        void sort(TCompare comp = {})
+        {
+            if (size_ < 2)
+                return;
+
+            constexpr size_t max_bins = 64;
+            Node* bins[max_bins] = {};
+            size_t no_of_bins = 0;
+
+            for (Node* node = head_; node;)
+            {
+                Node* run = std::exchange(node, node->next);
+                run->next = nullptr;
+
+                size_t i = 0;
+                for (; i < no_of_bins && bins[i]; ++i)
+                    run = merge(std::exchange(bins[i], nullptr), run, comp);
+
+                if (i == no_of_bins)
+                    ++no_of_bins;
+                bins[i] = run;
+            }
+
+            Node* sorted = nullptr;
+            for (size_t i = 0; i < no_of_bins; ++i)
+            {
+                if (bins[i])
+                    sorted = sorted ? merge(bins[i], sorted, comp) : bins[i];
+            }
+
+            head_ = tail_ = sorted;
+            while (tail_->next)
+                tail_ = tail_->next;
+        }
+
+        iterator begin()
+        {
+            return iterator{head_};
+        }
+
+        iterator end()
+        {
+            return iterator{};
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator{head_};
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator{};
+        }
+
+        friend std::ostream& operator<<(std::ostream& out, const FwdList& lst)
+        {
+            out << "[";
+
+            for (Node* node = lst.head_; node; node = node->next)
+            {
+                out << node->value;
+
+                if (node->next)
+                    out << ", ";
+            }
+
+            out << "]";
+
+            return out;
+        }
+
+    private:
+        std::unique_ptr<pool_type> own_pool_;
+        pool_type* pool_; // nullptr after the own pool was moved to another list
+        Node* head_{nullptr};
+        Node* tail_{nullptr};
+        size_t size_{0};
+
+        // pool of the moved-from list is created on the next allocation (nullptr after its own pool was moved away)
+        pool_type& acquire_pool()
+        {
+            if (!pool_)
+            {
+                own_pool_ = std::make_unique<pool_type>();
+                pool_ = own_pool_.get();
+            }
+
+            return *pool_;
+        }
+
+        // nodes of a list with other pool would be freed by that pool while still linked into this list
+        void check_same_pool(const FwdList& other) const
+        {
+            if (pool_ != other.pool_)
+                throw std::invalid_argument{"FwdList: spliced lists must share the same NodePool"};
+        }
+
+        // nodes were spliced into another list
+        void release_nodes() noexcept
+        {
+            head_ = tail_ = nullptr;
+            size_ = 0;
+        }
+
+        // merges two sorted chains - on equal items left goes first
+        template <typename TCompare>
+        static Node* merge(Node* left, Node* right, TCompare& comp)
+        {
+            Node* head = nullptr;
+            Node** link = &head;
+
+            while (left && right)
+            {
+                if (comp(right->value, left->value))
+                    *link = std::exchange(right, right->next);
+                else
+                    *link = std::exchange(left, left->next);
+
+                link = &(*link)->next;
+            }
+
+            *link = left ? left : right;
+
+            return head;
+        }
+
+        static void destroy_values(Node* node) noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (; node; node = node->next)
+                    std::destroy_at(&node->value);
+            }
+        }
+
+        // chain of nodes retired with its pool - destroyed by BackgroundReclaimer
+        struct RetiredChain
+        {
+            std::unique_ptr<pool_type> pool;
+            Node* head;
+
+            RetiredChain(std::unique_ptr<pool_type> p, Node* h) noexcept
+                : pool{std::move(p)}
+                , head{h}
+            {
+            }
+
+            RetiredChain(RetiredChain&& other) noexcept
+                : pool{std::move(other.pool)}
+                , head{std::exchange(other.head, nullptr)}
+            {
+            }
+
+            ~RetiredChain()
+            {
+                destroy_values(head);
+            } // slabs are released by the pool
+        };
     };
 }
 
@@ -0,0 +1,111 @@
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ModernCpp
+{
+    namespace Detail
+    {
+        // node of singly linked list - value is constructed & destroyed manually,
+        // the node itself (and its link) lives as long as the slab it was carved from
+        template <typename T>
+        struct FwdListNode
+        {
+            FwdListNode* next;
+
+            union
+            {
+                T value;
+            };
+
+            FwdListNode() noexcept
+            {
+            }
+
+            ~FwdListNode()
+            {
+            }
+        };
+    }
+
+    // Slab allocator for list nodes:
+    // - nodes are carved from slabs (contiguous arrays) that grow geometrically
+    // - released nodes go to an intrusive free list (linked by their own next pointers) & are reused first
+    // - a whole chain of nodes can be released in O(1)
+    // - not thread-safe: share one pool between lists used by the same thread (e.g. thread_local pool)
+    template <typename T>
+    class NodePool
+    {
+    public:
+        using Node = Detail::FwdListNode<T>;
+
+    private:
+        std::vector<std::unique_ptr<Node[]>> slabs_;
+        Node* free_list_{nullptr};
+        Node* slab_position_{nullptr};
+        Node* slab_end_{nullptr};
+        size_t next_slab_size_;
+        size_t capacity_{0};
+
+        static constexpr size_t max_slab_size = 64 * 1024;
+
+    public:
+        explicit NodePool(size_t initial_slab_size = 64)
+            : next_slab_size_{std::max<size_t>(initial_slab_size, 1)}
+        {
+        }
+
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        // number of nodes in all slabs
+        size_t capacity() const
+        {
+            return capacity_;
+        }
+
+        // returns node with uninitialized value
+        Node* allocate()
+        {
+            if (free_list_)
+                return std::exchange(free_list_, free_list_->next);
+
+            if (slab_position_ == slab_end_)
+                add_slab();
+
+            return slab_position_++;
+        }
+
+        // value of the node must be already destroyed
+        void deallocate(Node* node) noexcept
+        {
+            node->next = free_list_;
+            free_list_ = node;
+        }
+
+        // releases chain [first, last] linked by next pointers - values must be already destroyed
+        void deallocate_chain(Node* first, Node* last) noexcept
+        {
+            last->next = free_list_;
+            free_list_ = first;
+        }
+
+    private:
+        void add_slab()
+        {
+            slabs_.push_back(std::make_unique<Node[]>(next_slab_size_));
+            slab_position_ = slabs_.back().get();
+            slab_end_ = slab_position_ + next_slab_size_;
+            capacity_ += next_slab_size_;
+            next_slab_size_ = std::min(next_slab_size_ * 2, max_slab_size);
+        }
+    };
+}
+
+#endif
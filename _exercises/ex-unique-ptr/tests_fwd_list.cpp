@@ -1,5 +1,16 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include "fwd_list.hpp"
+#include <algorithm>
+#include <chrono>
+#include <forward_list>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
 
 TEST_CASE("Forward List")
 {
@@ -151,4 +162,611 @@ TEST_CASE("Forward List")
         for (int i = 0; i < 1'000'000; ++i)
             fwd_lst.push_front(i);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("ModernCpp::FwdList")
+{
+    using namespace ModernCpp;
+
+    SECTION("default construction")
+    {
+        FwdList<int> fwd_lst;
+
+        CHECK(fwd_lst.empty());
+        CHECK(fwd_lst.size() == 0);
+        CHECK(fwd_lst.begin() == fwd_lst.end());
+    }
+
+    SECTION("push_front & pop_front")
+    {
+        FwdList<int> fwd_lst;
+        fwd_lst.push_front(1);
+        fwd_lst.push_front(2);
+        fwd_lst.push_front(3);
+
+        CHECK(fwd_lst.size() == 3);
+        CHECK(fwd_lst.front() == 3);
+
+        fwd_lst.pop_front();
+
+        CHECK(fwd_lst.size() == 2);
+        CHECK(fwd_lst.front() == 2);
+    }
+
+    SECTION("emplace_front & iteration")
+    {
+        FwdList<std::string> fwd_lst;
+        fwd_lst.emplace_front(3, 'a');
+        fwd_lst.emplace_front("text");
+
+        std::vector<std::string> items(fwd_lst.begin(), fwd_lst.end());
+
+        CHECK(items == std::vector<std::string>{"text", "aaa"});
+    }
+
+    SECTION("move-only items")
+    {
+        FwdList<std::unique_ptr<int>> fwd_lst;
+        fwd_lst.push_front(std::make_unique<int>(42));
+
+        CHECK(*fwd_lst.front() == 42);
+    }
+
+    SECTION("move semantics")
+    {
+        FwdList<int> fwd_lst;
+        fwd_lst.push_front(1);
+        fwd_lst.push_front(2);
+
+        FwdList<int> target = std::move(fwd_lst);
+
+        CHECK(target.size() == 2);
+        CHECK(fwd_lst.empty());
+    }
+
+    SECTION("moved-from list can be reused")
+    {
+        FwdList<int> fwd_lst;
+        fwd_lst.push_front(1);
+
+        SECTION("after move construction")
+        {
+            {
+                FwdList<int> target = std::move(fwd_lst);
+            } // pool of fwd_lst was destroyed with target
+
+            fwd_lst.emplace_front(2);
+            fwd_lst.push_front(3);
+
+            CHECK(std::vector(fwd_lst.begin(), fwd_lst.end()) == std::vector{3, 2});
+        }
+
+        SECTION("after move assignment")
+        {
+            FwdList<int> target;
+            target.push_front(10);
+
+            target = std::move(fwd_lst);
+            fwd_lst.push_front(2);
+            target.push_front(0);
+
+            CHECK(std::vector(fwd_lst.begin(), fwd_lst.end()) == std::vector{2});
+            CHECK(std::vector(target.begin(), target.end()) == std::vector{0, 1});
+        }
+
+        SECTION("moved-from list keeps the shared pool")
+        {
+            NodePool<int> pool;
+            FwdList<int> lst_1{pool};
+            lst_1.push_front(1);
+
+            FwdList<int> lst_2 = std::move(lst_1);
+            lst_1.push_front(2);
+            lst_2.splice_front(lst_1);
+
+            CHECK(std::vector(lst_2.begin(), lst_2.end()) == std::vector{2, 1});
+        }
+    }
+
+    SECTION("operator <<")
+    {
+        FwdList<int> fwd_lst;
+        fwd_lst.push_front(1);
+        fwd_lst.push_front(2);
+        fwd_lst.push_front(3);
+
+        std::stringstream ss;
+        ss << fwd_lst;
+
+        CHECK(ss.str() == "[3, 2, 1]");
+    }
+
+    SECTION("items are destroyed")
+    {
+        auto sptr = std::make_shared<int>(42);
+
+        {
+            FwdList<std::shared_ptr<int>> fwd_lst;
+            fwd_lst.push_front(sptr);
+            fwd_lst.push_front(sptr);
+            fwd_lst.pop_front();
+
+            CHECK(sptr.use_count() == 2);
+        }
+
+        CHECK(sptr.use_count() == 1);
+    }
+
+    SECTION("nodes are recycled by the pool")
+    {
+        NodePool<int> pool;
+        FwdList<int> fwd_lst{pool};
+
+        for (int i = 0; i < 1'000; ++i)
+            fwd_lst.push_front(i);
+
+        size_t capacity = pool.capacity();
+
+        for (int round = 0; round < 10; ++round)
+        {
+            for (int i = 0; i < 1'000; ++i)
+                fwd_lst.pop_front();
+            for (int i = 0; i < 1'000; ++i)
+                fwd_lst.push_front(i);
+        }
+
+        CHECK(pool.capacity() == capacity);
+    }
+
+    SECTION("lists can share the pool")
+    {
+        NodePool<int> pool;
+
+        {
+            FwdList<int> lst_1{pool};
+            for (int i = 0; i < 100; ++i)
+                lst_1.push_front(i);
+        }
+
+        size_t capacity = pool.capacity();
+
+        FwdList<int> lst_2{pool};
+        for (int i = 0; i < 100; ++i)
+            lst_2.push_front(i);
+
+        CHECK(pool.capacity() == capacity);
+    }
+
+    SECTION("destruction of long list is stack-safe")
+    {
+        constexpr int no_of_items = 10'000'000;
+
+        SECTION("trivially destructible items")
+        {
+            FwdList<int> fwd_lst;
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.push_front(i);
+
+            CHECK(fwd_lst.size() == no_of_items);
+        }
+
+        SECTION("items with destructor")
+        {
+            FwdList<std::unique_ptr<int>> fwd_lst;
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.push_front(nullptr);
+
+            fwd_lst.clear();
+
+            CHECK(fwd_lst.empty());
+        }
+    }
+
+    SECTION("clear returns all nodes to the pool")
+    {
+        NodePool<int> pool;
+        FwdList<int> fwd_lst{pool};
+
+        for (int i = 0; i < 1'000; ++i)
+            fwd_lst.push_front(i);
+
+        size_t capacity = pool.capacity();
+
+        fwd_lst.clear();
+        CHECK(fwd_lst.empty());
+        CHECK(fwd_lst.begin() == fwd_lst.end());
+
+        for (int i = 0; i < 1'000; ++i)
+            fwd_lst.push_front(i);
+
+        CHECK(pool.capacity() == capacity);
+        CHECK(fwd_lst.front() == 999);
+    }
+
+    SECTION("clear_async")
+    {
+        auto sptr = std::make_shared<int>(42);
+
+        BackgroundReclaimer reclaimer;
+        FwdList<std::shared_ptr<int>> fwd_lst;
+
+        for (int i = 0; i < 1'000; ++i)
+            fwd_lst.push_front(sptr);
+
+        fwd_lst.clear_async(reclaimer);
+
+        CHECK(fwd_lst.empty());
+
+        fwd_lst.push_front(sptr);
+        CHECK(fwd_lst.size() == 1);
+
+        reclaimer.wait();
+
+        CHECK(sptr.use_count() == 2);
+    }
+
+    SECTION("splicing lists with shared pool")
+    {
+        NodePool<int> pool;
+        FwdList<int> lst_1{pool};
+        FwdList<int> lst_2{pool};
+
+        for (int i : {3, 2, 1})
+            lst_1.push_front(i);
+        for (int i : {5, 4})
+            lst_2.push_front(i);
+
+        SECTION("splice_front")
+        {
+            lst_1.splice_front(lst_2);
+
+            CHECK(std::vector(lst_1.begin(), lst_1.end()) == std::vector{4, 5, 1, 2, 3});
+            CHECK(lst_1.size() == 5);
+            CHECK(lst_2.empty());
+            CHECK(lst_2.begin() == lst_2.end());
+        }
+
+        SECTION("splice_after")
+        {
+            lst_1.splice_after(lst_1.begin(), lst_2);
+
+            CHECK(std::vector(lst_1.begin(), lst_1.end()) == std::vector{1, 4, 5, 2, 3});
+            CHECK(lst_1.size() == 5);
+            CHECK(lst_2.empty());
+        }
+
+        SECTION("splice_back")
+        {
+            lst_1.splice_back(lst_2);
+            lst_1.push_front(0);
+
+            CHECK(std::vector(lst_1.begin(), lst_1.end()) == std::vector{0, 1, 2, 3, 4, 5});
+
+            FwdList<int> lst_3{pool};
+            lst_3.push_front(6);
+            lst_1.splice_back(lst_3); // tail was updated by the previous splice
+
+            CHECK(std::vector(lst_1.begin(), lst_1.end()) == std::vector{0, 1, 2, 3, 4, 5, 6});
+        }
+
+        SECTION("splice into empty list")
+        {
+            FwdList<int> empty_lst{pool};
+            empty_lst.splice_back(lst_1);
+            empty_lst.splice_back(lst_2);
+
+            CHECK(std::vector(empty_lst.begin(), empty_lst.end()) == std::vector{1, 2, 3, 4, 5});
+            CHECK(empty_lst.size() == 5);
+        }
+    }
+
+    SECTION("splicing lists with different pools")
+    {
+        FwdList<int> lst_1;
+        FwdList<int> lst_2;
+        lst_1.push_front(1);
+        lst_2.push_front(2);
+
+        CHECK_THROWS_AS(lst_1.splice_front(lst_2), std::invalid_argument);
+        CHECK_THROWS_AS(lst_1.splice_after(lst_1.begin(), lst_2), std::invalid_argument);
+        CHECK_THROWS_AS(lst_1.splice_back(lst_2), std::invalid_argument);
+        CHECK(std::vector(lst_1.begin(), lst_1.end()) == std::vector{1});
+        CHECK(std::vector(lst_2.begin(), lst_2.end()) == std::vector{2});
+
+        SECTION("empty list is spliced as no-op - also moved-from list without pool")
+        {
+            FwdList<int> target = std::move(lst_2);
+
+            FwdList<int> empty_lst; // own pool
+            lst_1.splice_back(lst_2);
+            lst_1.splice_front(empty_lst);
+
+            CHECK(std::vector(lst_1.begin(), lst_1.end()) == std::vector{1});
+        }
+    }
+
+    SECTION("reverse")
+    {
+        FwdList<int> fwd_lst;
+        for (int i : {3, 2, 1})
+            fwd_lst.push_front(i);
+
+        fwd_lst.reverse();
+
+        CHECK(std::vector(fwd_lst.begin(), fwd_lst.end()) == std::vector{3, 2, 1});
+
+        fwd_lst.push_front(4);
+        fwd_lst.reverse();
+
+        CHECK(std::vector(fwd_lst.begin(), fwd_lst.end()) == std::vector{1, 2, 3, 4});
+    }
+
+    SECTION("sort")
+    {
+        SECTION("random items")
+        {
+            std::vector<int> items(10'007);
+            std::mt19937 rnd{42};
+            std::uniform_int_distribution<int> distr{0, 1'000};
+            std::ranges::generate(items, [&] { return distr(rnd); });
+
+            FwdList<int> fwd_lst;
+            for (int item : items)
+                fwd_lst.push_front(item);
+
+            fwd_lst.sort();
+            std::ranges::sort(items);
+
+            CHECK(std::vector(fwd_lst.begin(), fwd_lst.end()) == items);
+            CHECK(fwd_lst.size() == items.size());
+
+            fwd_lst.push_front(-1);
+            fwd_lst.pop_front();
+            fwd_lst.sort(std::greater<>{});
+
+            CHECK(std::ranges::is_sorted(fwd_lst, std::greater<>{}));
+        }
+
+        SECTION("is stable")
+        {
+            FwdList<std::pair<int, char>> fwd_lst;
+            for (auto item : {std::pair{2, 'a'}, {1, 'b'}, {2, 'c'}, {1, 'd'}, {0, 'e'}})
+                fwd_lst.push_front(item);
+
+            fwd_lst.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+
+            std::vector<std::pair<int, char>> expected = {{0, 'e'}, {1, 'd'}, {1, 'b'}, {2, 'c'}, {2, 'a'}};
+            CHECK(std::vector(fwd_lst.begin(), fwd_lst.end()) == expected);
+        }
+
+        SECTION("items are not moved")
+        {
+            FwdList<std::unique_ptr<int>> fwd_lst;
+            for (int i : {2, 3, 1})
+                fwd_lst.push_front(std::make_unique<int>(i));
+
+            // addresses of stored elements (not of pointees) - nodes are relinked, elements stay in place
+            const auto* one = &fwd_lst.front();
+            const auto* three = &*std::next(fwd_lst.begin());
+
+            fwd_lst.sort([](const auto& a, const auto& b) { return *a < *b; });
+
+            CHECK(*fwd_lst.front() == 1);
+            CHECK(&fwd_lst.front() == one);
+            CHECK(**std::next(fwd_lst.begin(), 2) == 3);
+            CHECK(&*std::next(fwd_lst.begin(), 2) == three);
+        }
+
+        SECTION("tail is valid after sort")
+        {
+            NodePool<int> pool;
+            FwdList<int> lst_1{pool};
+            FwdList<int> lst_2{pool};
+            for (int i : {3, 1, 2})
+                lst_1.push_front(i);
+            lst_2.push_front(10);
+
+            lst_1.sort();
+            lst_1.splice_back(lst_2);
+
+            CHECK(std::vector(lst_1.begin(), lst_1.end()) == std::vector{1, 2, 3, 10});
+        }
+    }
+}
+
+TEST_CASE("push_front/pop_front churn", "[.][benchmark]")
+{
+    constexpr int no_of_items = 1'000;
+    constexpr int no_of_rounds = 100;
+
+    BENCHMARK("LegacyCode::FwdList")
+    {
+        LegacyCode::FwdList<int> fwd_lst;
+        for (int round = 0; round < no_of_rounds; ++round)
+        {
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.push_front(i);
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.pop_front();
+        }
+        return fwd_lst.size();
+    };
+
+    BENCHMARK("std::forward_list")
+    {
+        std::forward_list<int> fwd_lst;
+        for (int round = 0; round < no_of_rounds; ++round)
+        {
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.push_front(i);
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.pop_front();
+        }
+        return fwd_lst.empty();
+    };
+
+    BENCHMARK("ModernCpp::FwdList")
+    {
+        ModernCpp::FwdList<int> fwd_lst;
+        for (int round = 0; round < no_of_rounds; ++round)
+        {
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.push_front(i);
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.pop_front();
+        }
+        return fwd_lst.size();
+    };
+
+    thread_local ModernCpp::NodePool<int> thread_pool;
+
+    BENCHMARK("ModernCpp::FwdList - per-thread pool")
+    {
+        ModernCpp::FwdList<int> fwd_lst{thread_pool};
+        for (int round = 0; round < no_of_rounds; ++round)
+        {
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.push_front(i);
+            for (int i = 0; i < no_of_items; ++i)
+                fwd_lst.pop_front();
+        }
+        return fwd_lst.size();
+    };
+}
+
+namespace
+{
+    // destruction has to be timed manually - building a list is far more expensive
+    // than O(1) clear_async(), so Catch would pre-build too many lists for one sample
+    template <typename TList, typename TDestroy>
+    void measure_destruction_latency(std::string_view name, TDestroy destroy, int no_of_items = 1'000'000, int no_of_samples = 10)
+    {
+        using namespace std::chrono;
+
+        nanoseconds total{}, worst{};
+
+        for (int sample = 0; sample < no_of_samples; ++sample)
+        {
+            auto lst = std::make_unique<TList>();
+            for (int i = 0; i < no_of_items; ++i)
+                lst->push_front("text");
+
+            auto start = steady_clock::now();
+            destroy(lst);
+            auto elapsed = steady_clock::now() - start;
+
+            total += elapsed;
+            worst = std::max<nanoseconds>(worst, elapsed);
+        }
+
+        std::cout << name << " - mean: " << duration<double, std::milli>(total).count() / no_of_samples
+                  << "ms; max: " << duration<double, std::milli>(worst).count() << "ms\n";
+    }
+}
+
+TEST_CASE("destruction latency", "[.][benchmark]")
+{
+    auto reset = [](auto& lst) { lst.reset(); };
+
+    measure_destruction_latency<LegacyCode::FwdList<std::string>>("LegacyCode::FwdList", reset);
+    measure_destruction_latency<std::forward_list<std::string>>("std::forward_list", reset);
+    measure_destruction_latency<ModernCpp::FwdList<std::string>>("ModernCpp::FwdList", reset);
+
+    ModernCpp::BackgroundReclaimer reclaimer;
+    measure_destruction_latency<ModernCpp::FwdList<std::string>>("ModernCpp::FwdList - clear_async", [&](auto& lst) {
+        lst->clear_async(reclaimer);
+    });
+    reclaimer.wait();
+}
+
+TEST_CASE("sorting lists", "[.][benchmark]")
+{
+    constexpr int no_of_items = 100'000;
+
+    std::vector<int> items(no_of_items);
+    std::mt19937 rnd{665};
+    std::uniform_int_distribution<int> distr{0, 1'000'000};
+    std::ranges::generate(items, [&] { return distr(rnd); });
+
+    auto make_lists = [&]<typename TList>(std::type_identity<TList>, int no_of_lists) {
+        std::vector<TList> lists(no_of_lists);
+        for (auto& lst : lists)
+            for (int item : items)
+                lst.push_front(item);
+        return lists;
+    };
+
+    BENCHMARK_ADVANCED("std::forward_list::sort")(Catch::Benchmark::Chronometer meter)
+    {
+        auto lists = make_lists(std::type_identity<std::forward_list<int>>{}, meter.runs());
+        meter.measure([&](int i) { lists[i].sort(); });
+    };
+
+    BENCHMARK_ADVANCED("ModernCpp::FwdList::sort")(Catch::Benchmark::Chronometer meter)
+    {
+        auto lists = make_lists(std::type_identity<ModernCpp::FwdList<int>>{}, meter.runs());
+        meter.measure([&](int i) { lists[i].sort(); });
+    };
+
+    BENCHMARK_ADVANCED("ModernCpp::FwdList - copy to vector, sort & rebuild")(Catch::Benchmark::Chronometer meter)
+    {
+        auto lists = make_lists(std::type_identity<ModernCpp::FwdList<int>>{}, meter.runs());
+        meter.measure([&](int i) {
+            std::vector<int> buffer(lists[i].begin(), lists[i].end());
+            std::ranges::sort(buffer);
+
+            lists[i].clear();
+            for (auto it = buffer.rbegin(); it != buffer.rend(); ++it)
+                lists[i].push_front(*it);
+        });
+    };
+
+    BENCHMARK_ADVANCED("ModernCpp::FwdList::reverse")(Catch::Benchmark::Chronometer meter)
+    {
+        auto lists = make_lists(std::type_identity<ModernCpp::FwdList<int>>{}, meter.runs());
+        meter.measure([&](int i) { lists[i].reverse(); });
+    };
+
+    BENCHMARK_ADVANCED("ModernCpp::FwdList - reverse by copying")(Catch::Benchmark::Chronometer meter)
+    {
+        auto lists = make_lists(std::type_identity<ModernCpp::FwdList<int>>{}, meter.runs());
+        meter.measure([&](int i) {
+            ModernCpp::FwdList<int> reversed;
+            for (int item : lists[i])
+                reversed.push_front(item);
+            lists[i] = std::move(reversed);
+        });
+    };
+}
+
+TEST_CASE("concatenating lists", "[.][benchmark]")
+{
+    constexpr int no_of_items = 100'000;
+
+    ModernCpp::NodePool<int> pool;
+    ModernCpp::FwdList<int> lst_1{pool};
+    ModernCpp::FwdList<int> lst_2{pool};
+    for (int i = 0; i < no_of_items; ++i)
+    {
+        lst_1.push_front(i);
+        lst_2.push_front(i);
+    }
+
+    BENCHMARK("ModernCpp::FwdList::splice_back")
+    {
+        lst_1.splice_back(lst_2); // all nodes go back & forth in O(1)
+        lst_2.splice_back(lst_1);
+        return lst_2.size();
+    };
+
+    BENCHMARK("ModernCpp::FwdList - concatenation by copying")
+    {
+        ModernCpp::FwdList<int> target{pool};
+
+        std::vector<int> buffer(lst_2.begin(), lst_2.end()); // list can be extended only at front
+        for (auto it = buffer.rbegin(); it != buffer.rend(); ++it)
+            target.push_front(*it);
+
+        return target.size();
+    };
+}
@@ -0,0 +1,23 @@
+#include "allocation_counter.hpp"
+#include <cstdlib>
+#include <new>
+
+void* operator new(size_t size)
+{
+    ++allocation_counter;
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
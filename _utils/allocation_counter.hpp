@@ -0,0 +1,18 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+
+// number of calls to global operator new (replaced in allocation_counter.cpp)
+// - one replacement per test executable: link the allocation_counter library instead of redefining operator new
+inline std::atomic<size_t> allocation_counter{0};
+
+inline size_t allocations_during(auto&& action)
+{
+    size_t before = allocation_counter.load();
+    action();
+    return allocation_counter.load() - before;
+}
+
+#endif
@@ -0,0 +1,413 @@
+#ifndef PROPERTY_BAG_HPP
+#define PROPERTY_BAG_HPP
+
+#include <algorithm>
+#include <any>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ModernCpp
+{
+    namespace Detail
+    {
+        // global registry of interned property names - thread-safe
+        // - names are never removed, so ids & views of names stay valid for the lifetime of the program
+        class KeyRegistry
+        {
+            mutable std::mutex mtx_;
+            std::deque<std::string> names_; // deque - views of names are not invalidated by push_back
+            std::unordered_map<std::string_view, uint32_t> ids_;
+
+        public:
+            static KeyRegistry& instance()
+            {
+                static KeyRegistry registry;
+                return registry;
+            }
+
+            uint32_t intern(std::string_view name)
+            {
+                std::lock_guard lk{mtx_};
+
+                if (auto it = ids_.find(name); it != ids_.end())
+                    return it->second;
+
+                uint32_t id = static_cast<uint32_t>(names_.size());
+                ids_.emplace(names_.emplace_back(name), id);
+
+                return id;
+            }
+
+            std::optional<uint32_t> find(std::string_view name) const
+            {
+                std::lock_guard lk{mtx_};
+
+                if (auto it = ids_.find(name); it != ids_.end())
+                    return it->second;
+
+                return std::nullopt;
+            }
+
+            // placeholder for ids that were not interned (e.g. PropertyKey::invalid())
+            std::string_view name(uint32_t id) const
+            {
+                std::lock_guard lk{mtx_};
+
+                if (id >= names_.size())
+                    return "<invalid key>";
+
+                return names_[id];
+            }
+        };
+
+        inline std::atomic<uint32_t> next_property_type_index{0};
+
+        // dense index of a type stored in property bags (assigned on first use)
+        template <typename T>
+        uint32_t property_type_index()
+        {
+            static const uint32_t index = next_property_type_index.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+    }
+
+    // Interned name of a property:
+    // - construction looks the name up in the global registry (hash + lock) - create keys once & reuse them
+    // - comparison & lookup in PropertyBag uses the dense integer id only
+    class PropertyKey
+    {
+        uint32_t id_;
+
+        explicit PropertyKey(uint32_t id) noexcept
+            : id_{id}
+        {
+        }
+
+    public:
+        explicit PropertyKey(std::string_view name)
+            : id_{Detail::KeyRegistry::instance().intern(name)}
+        {
+        }
+
+        // key for an already interned name - the registry is not modified
+        static std::optional<PropertyKey> find(std::string_view name)
+        {
+            if (auto id = Detail::KeyRegistry::instance().find(name))
+                return PropertyKey{*id};
+
+            return std::nullopt;
+        }
+
+        uint32_t id() const noexcept
+        {
+            return id_;
+        }
+
+        std::string_view name() const
+        {
+            return Detail::KeyRegistry::instance().name(id_);
+        }
+
+        // key that is never returned for a name
+        static PropertyKey invalid() noexcept
+        {
+            return PropertyKey{UINT32_MAX};
+        }
+
+        bool operator==(const PropertyKey&) const = default;
+    };
+
+    // Heterogeneous container of named properties (replacement for std::map<std::string, std::any>):
+    // - values are grouped by type into contiguous typed columns (one vector per type) - no allocation per value
+    // - entry table indexed by key id maps a key to (column, slot) - O(1) lookup without hashing or type_info comparison
+    // - the entry table grows up to the biggest key id used in the bag (8 bytes per interned key)
+    // - erase swaps the last value of the column into the gap - references to values of the same type
+    //   are invalidated by set() & erase()
+    class PropertyBag
+    {
+        struct ColumnBase
+        {
+            virtual ~ColumnBase() = default;
+            virtual std::unique_ptr<ColumnBase> clone() const = 0;
+            virtual const std::type_info& type() const noexcept = 0;
+            virtual PropertyKey remove(uint32_t slot) = 0; // returns key of the value moved into the slot
+        };
+
+        template <typename T>
+        struct Cell // value & its key in one allocation; no std::vector<bool> proxies
+        {
+            T value;
+            PropertyKey key;
+        };
+
+        template <typename T>
+        struct Column : ColumnBase
+        {
+            static constexpr size_t initial_capacity = 4;
+
+            std::vector<Cell<T>> cells;
+
+            Column()
+            {
+                cells.reserve(initial_capacity);
+            }
+
+            std::unique_ptr<ColumnBase> clone() const override
+            {
+                return std::make_unique<Column>(*this);
+            }
+
+            const std::type_info& type() const noexcept override
+            {
+                return typeid(T);
+            }
+
+            PropertyKey remove(uint32_t slot) override
+            {
+                if (slot != cells.size() - 1)
+                    cells[slot] = std::move(cells.back());
+                cells.pop_back();
+
+                return slot < cells.size() ? cells[slot].key : PropertyKey::invalid();
+            }
+        };
+
+        struct Entry
+        {
+            uint32_t column; // type index + 1; 0 - no value for the key
+            uint32_t slot;
+        };
+
+        static constexpr size_t min_table_size = 16;
+
+        std::vector<Entry> entries_;
+        std::vector<std::unique_ptr<ColumnBase>> columns_; // indexed by type index
+        size_t size_{0};
+
+        const Entry* find_entry(PropertyKey key) const noexcept
+        {
+            if (key.id() >= entries_.size() || entries_[key.id()].column == 0)
+                return nullptr;
+
+            return &entries_[key.id()];
+        }
+
+        template <typename T>
+        Column<T>* column() const noexcept
+        {
+            uint32_t index = Detail::property_type_index<T>();
+
+            if (index >= columns_.size())
+                return nullptr;
+
+            return static_cast<Column<T>*>(columns_[index].get());
+        }
+
+        template <typename T>
+        Column<T>& column_for_insert()
+        {
+            uint32_t index = Detail::property_type_index<T>();
+
+            if (index >= columns_.size())
+                columns_.resize(std::max<size_t>(index + 1, min_table_size));
+
+            if (!columns_[index])
+                columns_[index] = std::make_unique<Column<T>>();
+
+            return static_cast<Column<T>&>(*columns_[index]);
+        }
+
+        void remove(Entry& entry)
+        {
+            PropertyKey moved_key = columns_[entry.column - 1]->remove(entry.slot);
+            if (moved_key != PropertyKey::invalid())
+                entries_[moved_key.id()].slot = entry.slot;
+            entry = Entry{0, 0};
+            --size_;
+        }
+
+    public:
+        PropertyBag() = default;
+
+        PropertyBag(const PropertyBag& other)
+            : entries_{other.entries_}
+            , size_{other.size_}
+        {
+            columns_.reserve(other.columns_.size());
+            for (const auto& column : other.columns_)
+                columns_.push_back(column ? column->clone() : nullptr);
+        }
+
+        PropertyBag& operator=(const PropertyBag& other)
+        {
+            if (this != &other)
+            {
+                PropertyBag temp{other};
+                *this = std::move(temp);
+            }
+
+            return *this;
+        }
+
+        PropertyBag(PropertyBag&&) noexcept = default;
+        PropertyBag& operator=(PropertyBag&&) noexcept = default;
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        // inserts or assigns the value - the value of other type stored for the key is erased
+        // throws std::invalid_argument for PropertyKey::invalid()
+        template <typename TValue, typename T = std::decay_t<TValue>>
+        T& set(PropertyKey key, TValue&& value)
+        {
+            if (key == PropertyKey::invalid())
+                throw std::invalid_argument{"PropertyBag: value cannot be set for invalid key"};
+
+            const uint32_t column_id = Detail::property_type_index<T>() + 1;
+
+            if (key.id() >= entries_.size()) // geometric growth - keys are usually interned in ascending order
+                entries_.resize(std::max<size_t>({size_t{key.id()} + 1, 2 * entries_.size(), min_table_size}), Entry{0, 0});
+
+            Column<T>& col = column_for_insert<T>();
+            Entry& entry = entries_[key.id()];
+
+            if (entry.column == column_id)
+                return col.cells[entry.slot].value = std::forward<TValue>(value);
+
+            col.cells.push_back(Cell<T>{std::forward<TValue>(value), key});
+
+            if (entry.column != 0)
+                remove(entry);
+
+            entry = Entry{column_id, static_cast<uint32_t>(col.cells.size() - 1)};
+            ++size_;
+
+            return col.cells.back().value;
+        }
+
+        // nullptr if there is no value for the key or the value has other type
+        template <typename T>
+        T* get(PropertyKey key) noexcept
+        {
+            return const_cast<T*>(std::as_const(*this).get<T>(key));
+        }
+
+        template <typename T>
+        const T* get(PropertyKey key) const noexcept
+        {
+            const Entry* entry = find_entry(key);
+
+            if (!entry || entry->column != Detail::property_type_index<T>() + 1)
+                return nullptr;
+
+            return &static_cast<const Column<T>&>(*columns_[entry->column - 1]).cells[entry->slot].value;
+        }
+
+        // throws std::out_of_range if there is no value for the key & std::bad_any_cast if the value has other type
+        template <typename T>
+        T& at(PropertyKey key)
+        {
+            return const_cast<T&>(std::as_const(*this).at<T>(key));
+        }
+
+        template <typename T>
+        const T& at(PropertyKey key) const
+        {
+            if (!contains(key))
+                throw std::out_of_range{"PropertyBag: no property " + std::string{key.name()}};
+
+            if (const T* value = get<T>(key))
+                return *value;
+
+            throw std::bad_any_cast{};
+        }
+
+        bool contains(PropertyKey key) const noexcept
+        {
+            return find_entry(key) != nullptr;
+        }
+
+        template <typename T>
+        bool contains(PropertyKey key) const noexcept
+        {
+            return get<T>(key) != nullptr;
+        }
+
+        // typeid(void) if there is no value for the key
+        const std::type_info& type(PropertyKey key) const noexcept
+        {
+            const Entry* entry = find_entry(key);
+            return entry ? columns_[entry->column - 1]->type() : typeid(void);
+        }
+
+        bool erase(PropertyKey key)
+        {
+            if (!contains(key))
+                return false;
+
+            remove(entries_[key.id()]);
+            return true;
+        }
+
+        void clear() noexcept
+        {
+            entries_.clear();
+            columns_.clear();
+            size_ = 0;
+        }
+
+        // all values of type T stored in the bag (random access range) - values<T>()[i] belongs to keys<T>()[i]
+        template <typename T>
+        auto values() const noexcept
+        {
+            std::span<const Cell<T>> cells;
+            if (Column<T>* col = column<T>())
+                cells = col->cells;
+
+            return cells | std::views::transform(&Cell<T>::value);
+        }
+
+        template <typename T>
+        auto values() noexcept
+        {
+            std::span<Cell<T>> cells;
+            if (Column<T>* col = column<T>())
+                cells = col->cells;
+
+            return cells | std::views::transform(&Cell<T>::value);
+        }
+
+        template <typename T>
+        auto keys() const noexcept
+        {
+            std::span<const Cell<T>> cells;
+            if (Column<T>* col = column<T>())
+                cells = col->cells;
+
+            return cells | std::views::transform(&Cell<T>::key);
+        }
+    };
+}
+
+#endif
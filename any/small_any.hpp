@@ -0,0 +1,310 @@
+#ifndef SMALL_ANY_HPP
+#define SMALL_ANY_HPP
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace ModernCpp
+{
+    namespace Detail
+    {
+        template <typename T>
+        constexpr bool is_in_place_type_v = false;
+
+        template <typename T>
+        constexpr bool is_in_place_type_v<std::in_place_type_t<T>> = true;
+    }
+
+    // Replacement for std::any with configurable small buffer:
+    // - objects up to InlineSize bytes (nothrow movable) are stored in the object - no allocation
+    // - bigger objects are allocated on the heap
+    // - IsCopyable = false gives move-only version, that accepts move-only types (e.g. std::unique_ptr)
+    // - any_cast<T>(&a) compares the vtable pointer only (no type_info comparison)
+    //   (vtable is an inline variable - unique in the program, unless it is hidden in a shared library)
+    template <size_t InlineSize, bool IsCopyable>
+    class BasicSmallAny
+    {
+        struct VTable
+        {
+            const std::type_info& (*type)() noexcept;
+            void (*copy_to)(const void* source, void* target); // nullptr for move-only any
+            void (*move_to)(void* source, void* target) noexcept; // move-constructs target & destroys source
+            void (*destroy)(void* storage) noexcept;
+            bool is_inline;
+        };
+
+        template <typename T>
+        static constexpr bool is_stored_inline = sizeof(T) <= InlineSize
+            && alignof(T) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<T>;
+
+        template <typename T>
+        struct InlineStorage
+        {
+            static T* get(void* storage)
+            {
+                return std::launder(static_cast<T*>(storage));
+            }
+
+            static const std::type_info& type() noexcept
+            {
+                return typeid(T);
+            }
+
+            static void copy_to(const void* source, void* target)
+            {
+                new (target) T(*get(const_cast<void*>(source)));
+            }
+
+            static constexpr auto copy_function() // copy_to is not instantiated for move-only any
+            {
+                if constexpr (IsCopyable)
+                    return &copy_to;
+                else
+                    return static_cast<decltype(&copy_to)>(nullptr);
+            }
+
+            static void move_to(void* source, void* target) noexcept
+            {
+                new (target) T(std::move(*get(source)));
+                std::destroy_at(get(source));
+            }
+
+            static void destroy(void* storage) noexcept
+            {
+                std::destroy_at(get(storage));
+            }
+
+            static constexpr VTable vtable{&type, copy_function(), &move_to, &destroy, true};
+        };
+
+        template <typename T>
+        struct HeapStorage
+        {
+            static T* get(void* storage)
+            {
+                return *std::launder(static_cast<T**>(storage));
+            }
+
+            static const std::type_info& type() noexcept
+            {
+                return typeid(T);
+            }
+
+            static void copy_to(const void* source, void* target)
+            {
+                new (target) T*(new T(*get(const_cast<void*>(source))));
+            }
+
+            static constexpr auto copy_function()
+            {
+                if constexpr (IsCopyable)
+                    return &copy_to;
+                else
+                    return static_cast<decltype(&copy_to)>(nullptr);
+            }
+
+            static void move_to(void* source, void* target) noexcept
+            {
+                new (target) T*(get(source));
+            }
+
+            static void destroy(void* storage) noexcept
+            {
+                delete get(storage);
+            }
+
+            static constexpr VTable vtable{&type, copy_function(), &move_to, &destroy, false};
+        };
+
+        template <typename T>
+        using Storage = std::conditional_t<is_stored_inline<T>, InlineStorage<T>, HeapStorage<T>>;
+
+        alignas(std::max_align_t) std::byte storage_[InlineSize < sizeof(void*) ? sizeof(void*) : InlineSize];
+        const VTable* vtable_{nullptr};
+
+        template <typename T, size_t Size, bool Copyable>
+        friend T* any_cast(BasicSmallAny<Size, Copyable>* any) noexcept;
+
+    public:
+        static constexpr size_t inline_capacity = InlineSize;
+
+        BasicSmallAny() noexcept = default;
+
+        template <typename TValue, typename T = std::decay_t<TValue>,
+            typename = std::enable_if_t<!std::is_same_v<T, BasicSmallAny> && !Detail::is_in_place_type_v<T>>>
+        BasicSmallAny(TValue&& value)
+        {
+            emplace<T>(std::forward<TValue>(value));
+        }
+
+        template <typename T, typename... TArgs>
+        explicit BasicSmallAny(std::in_place_type_t<T>, TArgs&&... args)
+        {
+            emplace<T>(std::forward<TArgs>(args)...);
+        }
+
+        BasicSmallAny(const BasicSmallAny& other) requires IsCopyable
+            : vtable_{other.vtable_}
+        {
+            if (vtable_)
+                vtable_->copy_to(other.storage_, storage_);
+        }
+
+        BasicSmallAny& operator=(const BasicSmallAny& other) requires IsCopyable
+        {
+            if (this != &other)
+            {
+                BasicSmallAny temp{other};
+                *this = std::move(temp);
+            }
+
+            return *this;
+        }
+
+        BasicSmallAny(BasicSmallAny&& other) noexcept
+            : vtable_{std::exchange(other.vtable_, nullptr)}
+        {
+            if (vtable_)
+                vtable_->move_to(other.storage_, storage_);
+        }
+
+        BasicSmallAny& operator=(BasicSmallAny&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+
+                vtable_ = std::exchange(other.vtable_, nullptr);
+                if (vtable_)
+                    vtable_->move_to(other.storage_, storage_);
+            }
+
+            return *this;
+        }
+
+        // value is copied before the old one is destroyed - it may refer to the current contents (a = *any_cast<T>(&a))
+        template <typename TValue, typename T = std::decay_t<TValue>, typename = std::enable_if_t<!std::is_same_v<T, BasicSmallAny>>>
+        BasicSmallAny& operator=(TValue&& value)
+        {
+            BasicSmallAny temp{std::forward<TValue>(value)};
+            *this = std::move(temp);
+
+            return *this;
+        }
+
+        ~BasicSmallAny()
+        {
+            reset();
+        }
+
+        // the old value is destroyed before the new one is constructed (like std::any::emplace)
+        template <typename T, typename... TArgs>
+        T& emplace(TArgs&&... args)
+        {
+            static_assert(!IsCopyable || std::is_copy_constructible_v<T>, "SmallAny requires copyable type - use UniqueAny");
+
+            reset();
+
+            if constexpr (is_stored_inline<T>)
+                new (storage_) T(std::forward<TArgs>(args)...);
+            else
+                new (storage_) T*(new T(std::forward<TArgs>(args)...));
+
+            vtable_ = &Storage<T>::vtable;
+
+            return *Storage<T>::get(storage_);
+        }
+
+        void reset() noexcept
+        {
+            if (vtable_)
+                std::exchange(vtable_, nullptr)->destroy(storage_);
+        }
+
+        bool has_value() const noexcept
+        {
+            return vtable_ != nullptr;
+        }
+
+        const std::type_info& type() const noexcept
+        {
+            return vtable_ ? vtable_->type() : typeid(void);
+        }
+
+        // true if the stored object is kept in the small buffer
+        bool is_inline() const noexcept
+        {
+            return vtable_ != nullptr && vtable_->is_inline;
+        }
+    };
+
+    // nullptr if the any is empty or holds other type - never throws
+    template <typename T, size_t InlineSize, bool IsCopyable>
+    T* any_cast(BasicSmallAny<InlineSize, IsCopyable>* any) noexcept
+    {
+        using TAny = BasicSmallAny<InlineSize, IsCopyable>;
+        using TStorage = typename TAny::template Storage<T>;
+
+        if (!any || !any->vtable_)
+            return nullptr;
+
+        if (any->vtable_ != &TStorage::vtable)
+            return nullptr;
+
+        return TStorage::get(any->storage_);
+    }
+
+    template <typename T, size_t InlineSize, bool IsCopyable>
+    const T* any_cast(const BasicSmallAny<InlineSize, IsCopyable>* any) noexcept
+    {
+        return any_cast<T>(const_cast<BasicSmallAny<InlineSize, IsCopyable>*>(any));
+    }
+
+    // throws std::bad_any_cast if the any holds other type
+    template <typename T, size_t InlineSize, bool IsCopyable>
+    T any_cast(const BasicSmallAny<InlineSize, IsCopyable>& any)
+    {
+        using U = std::remove_cvref_t<T>;
+
+        if (const U* ptr = any_cast<U>(&any))
+            return static_cast<T>(*ptr);
+
+        throw std::bad_any_cast{};
+    }
+
+    template <typename T, size_t InlineSize, bool IsCopyable>
+    T any_cast(BasicSmallAny<InlineSize, IsCopyable>& any)
+    {
+        using U = std::remove_cvref_t<T>;
+
+        if (U* ptr = any_cast<U>(&any))
+            return static_cast<T>(*ptr);
+
+        throw std::bad_any_cast{};
+    }
+
+    template <typename T, size_t InlineSize, bool IsCopyable>
+    T any_cast(BasicSmallAny<InlineSize, IsCopyable>&& any)
+    {
+        using U = std::remove_cvref_t<T>;
+
+        if (U* ptr = any_cast<U>(&any))
+            return static_cast<T>(std::move(*ptr));
+
+        throw std::bad_any_cast{};
+    }
+
+    template <size_t InlineSize = 32>
+    using SmallAny = BasicSmallAny<InlineSize, true>;
+
+    template <size_t InlineSize = 32>
+    using UniqueAny = BasicSmallAny<InlineSize, false>;
+}
+
+#endif
@@ -0,0 +1,296 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "allocation_counter.hpp"
+#include "property_bag.hpp"
+#include <any>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+using ModernCpp::PropertyBag;
+using ModernCpp::PropertyKey;
+
+TEST_CASE("PropertyKey")
+{
+    const PropertyKey width{"width"};
+
+    SECTION("names are interned")
+    {
+        CHECK(PropertyKey{"width"} == width);
+        CHECK(PropertyKey{"height"} != width);
+        CHECK(width.name() == "width");
+    }
+
+    SECTION("find does not intern")
+    {
+        CHECK(PropertyKey::find("width") == width);
+        CHECK(PropertyKey::find("never-interned-name") == std::nullopt);
+    }
+}
+
+TEST_CASE("PropertyBag")
+{
+    const PropertyKey width{"width"};
+    const PropertyKey height{"height"};
+    const PropertyKey name{"name"};
+    const PropertyKey ratio{"ratio"};
+
+    PropertyBag bag;
+
+    CHECK(bag.empty());
+
+    bag.set(width, 640);
+    bag.set(height, 480);
+    bag.set(name, "window"s);
+    bag.set(ratio, 1.33);
+
+    CHECK(bag.size() == 4);
+
+    SECTION("typed lookup")
+    {
+        REQUIRE(bag.get<int>(width) != nullptr);
+        CHECK(*bag.get<int>(width) == 640);
+        CHECK(bag.at<std::string>(name) == "window");
+        CHECK(bag.type(ratio) == typeid(double));
+    }
+
+    SECTION("lookup with wrong type or missing key")
+    {
+        const PropertyKey depth{"depth"};
+
+        CHECK(bag.get<double>(width) == nullptr);
+        CHECK(bag.get<int>(depth) == nullptr);
+        CHECK(bag.contains(width));
+        CHECK_FALSE(bag.contains<double>(width));
+        CHECK(bag.type(depth) == typeid(void));
+
+        CHECK_THROWS_AS(bag.at<double>(width), std::bad_any_cast);
+        CHECK_THROWS_AS(bag.at<int>(depth), std::out_of_range);
+        CHECK_THROWS_AS(bag.at<int>(PropertyKey::invalid()), std::out_of_range);
+        CHECK(PropertyKey::invalid().name() == "<invalid key>");
+    }
+
+    SECTION("set assigns value of the same type")
+    {
+        bag.set(width, 800);
+
+        CHECK(bag.at<int>(width) == 800);
+        CHECK(bag.size() == 4);
+    }
+
+    SECTION("set with other type replaces the value")
+    {
+        bag.set(width, "auto"s);
+
+        CHECK(bag.get<int>(width) == nullptr);
+        CHECK(bag.at<std::string>(width) == "auto");
+        CHECK(bag.at<int>(height) == 480);
+        CHECK(bag.size() == 4);
+    }
+
+    SECTION("set with invalid key throws")
+    {
+        CHECK_THROWS_AS(bag.set(PropertyKey::invalid(), 1), std::invalid_argument);
+
+        CHECK_FALSE(bag.contains(PropertyKey::invalid()));
+        CHECK(bag.size() == 4);
+    }
+
+    SECTION("values of the same type are stored in one contiguous column")
+    {
+        CHECK(bag.values<int>().size() == 2);
+        CHECK(bag.keys<int>().size() == 2);
+        CHECK(bag.keys<int>()[0] == width);
+        CHECK(&bag.values<int>()[1] == bag.get<int>(height));
+        CHECK(bag.values<float>().empty());
+
+        int sum = 0;
+        for (int value : bag.values<int>())
+            sum += value;
+        CHECK(sum == 1120);
+    }
+
+    SECTION("erase")
+    {
+        CHECK(bag.erase(width));
+        CHECK_FALSE(bag.erase(width));
+
+        CHECK_FALSE(bag.contains(width));
+        CHECK(bag.at<int>(height) == 480); // moved into the gap
+        CHECK(bag.size() == 3);
+
+        bag.set(width, 1024);
+        CHECK(bag.at<int>(width) == 1024);
+        CHECK(bag.at<int>(height) == 480);
+    }
+
+    SECTION("copy is deep")
+    {
+        PropertyBag copy = bag;
+        copy.at<std::string>(name) = "dialog";
+
+        CHECK(bag.at<std::string>(name) == "window");
+        CHECK(copy.at<std::string>(name) == "dialog");
+        CHECK(copy.size() == bag.size());
+    }
+
+    SECTION("move")
+    {
+        PropertyBag target = std::move(bag);
+
+        CHECK(target.at<int>(width) == 640);
+        CHECK(target.size() == 4);
+    }
+
+    SECTION("clear")
+    {
+        bag.clear();
+
+        CHECK(bag.empty());
+        CHECK_FALSE(bag.contains(name));
+    }
+}
+
+TEST_CASE("PropertyBag - no allocation per value")
+{
+    std::vector<PropertyKey> keys;
+    for (int i = 0; i < 64; ++i)
+        keys.emplace_back("property-" + std::to_string(i));
+
+    PropertyBag bag;
+    for (size_t i = 0; i < keys.size(); ++i)
+        bag.set(keys[i], static_cast<int>(i));
+
+    CHECK(allocations_during([&] {
+        for (size_t i = 0; i < keys.size(); ++i)
+            bag.set(keys[i], static_cast<int>(i) * 3);
+    }) == 0);
+
+    CHECK(allocations_during([&] {
+        long sum = 0;
+        for (const auto& key : keys)
+            sum += bag.at<int>(key);
+        CHECK(sum == 3 * 63 * 64 / 2);
+    }) == 0);
+}
+
+TEST_CASE("PropertyBag vs std::map of std::any", "[.][benchmark]")
+{
+    constexpr int no_of_entities = 10'000;
+
+    const PropertyKey id{"id"};
+    const PropertyKey x{"x"};
+    const PropertyKey y{"y"};
+    const PropertyKey speed{"speed"};
+    const PropertyKey health{"health"};
+    const PropertyKey name{"name"};
+    const PropertyKey tag{"tag"};
+    const PropertyKey visible{"visible"};
+
+    auto fill_map = [](std::map<std::string, std::any>& entity, int i) {
+        entity["id"] = i;
+        entity["x"] = i * 1.0;
+        entity["y"] = i * 2.0;
+        entity["speed"] = 1.5;
+        entity["health"] = 100;
+        entity["name"] = "entity-with-long-name-"s + std::to_string(i);
+        entity["tag"] = "enemy"s;
+        entity["visible"] = true;
+    };
+
+    auto fill_bag = [&](PropertyBag& entity, int i) {
+        entity.set(id, i);
+        entity.set(x, i * 1.0);
+        entity.set(y, i * 2.0);
+        entity.set(speed, 1.5);
+        entity.set(health, 100);
+        entity.set(name, "entity-with-long-name-"s + std::to_string(i));
+        entity.set(tag, "enemy"s);
+        entity.set(visible, true);
+    };
+
+    {
+        std::map<std::string, std::any> map_entity;
+        PropertyBag bag_entity;
+
+        std::cout << "Allocations per entity with 8 properties - std::map<std::string, std::any>: "
+                  << allocations_during([&] { fill_map(map_entity, 42); })
+                  << ", PropertyBag: " << allocations_during([&] { fill_bag(bag_entity, 42); }) << "\n";
+    }
+
+    std::vector<std::map<std::string, std::any>> map_entities(no_of_entities);
+    std::vector<PropertyBag> bag_entities(no_of_entities);
+    for (int i = 0; i < no_of_entities; ++i)
+    {
+        fill_map(map_entities[i], i);
+        fill_bag(bag_entities[i], i);
+    }
+
+    BENCHMARK("build - std::map<std::string, std::any>")
+    {
+        std::map<std::string, std::any> entity;
+        fill_map(entity, 42);
+        return entity.size();
+    };
+
+    BENCHMARK("build - PropertyBag")
+    {
+        PropertyBag entity;
+        fill_bag(entity, 42);
+        return entity.size();
+    };
+
+    BENCHMARK("lookup - std::map<std::string, std::any>")
+    {
+        double sum = 0.0;
+        for (const auto& entity : map_entities)
+        {
+            if (auto it = entity.find("x"); it != entity.end())
+                if (const double* value = std::any_cast<double>(&it->second))
+                    sum += *value;
+            if (auto it = entity.find("health"); it != entity.end())
+                if (const int* value = std::any_cast<int>(&it->second))
+                    sum += *value;
+        }
+        return sum;
+    };
+
+    BENCHMARK("lookup - PropertyBag")
+    {
+        double sum = 0.0;
+        for (const auto& entity : bag_entities)
+        {
+            if (const double* value = entity.get<double>(x))
+                sum += *value;
+            if (const int* value = entity.get<int>(health))
+                sum += *value;
+        }
+        return sum;
+    };
+
+    BENCHMARK("lookup by name - PropertyBag")
+    {
+        double sum = 0.0;
+        for (const auto& entity : bag_entities)
+        {
+            if (const double* value = entity.get<double>(PropertyKey{"x"}))
+                sum += *value;
+            if (const int* value = entity.get<int>(PropertyKey{"health"}))
+                sum += *value;
+        }
+        return sum;
+    };
+
+    BENCHMARK("scan column - PropertyBag")
+    {
+        double sum = 0.0;
+        for (const auto& entity : bag_entities)
+            for (double value : entity.values<double>())
+                sum += value;
+        return sum;
+    };
+}
@@ -0,0 +1,219 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "allocation_counter.hpp"
+#include "small_any.hpp"
+#include <any>
+#include <array>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("SmallAny")
+{
+    using ModernCpp::any_cast;
+    using ModernCpp::SmallAny;
+
+    SmallAny<> anything;
+
+    CHECK(anything.has_value() == false);
+    CHECK(anything.type() == typeid(void));
+
+    SECTION("the same API as std::any")
+    {
+        anything = 42;
+        anything = "text"s;
+        anything = 3.14;
+        anything = std::vector{1, 2, 3};
+
+        CHECK(any_cast<std::vector<int>>(anything) == std::vector{1, 2, 3}); // the copy of vector is returned
+        CHECK_THROWS_AS(any_cast<double>(anything), std::bad_any_cast);
+        CHECK(anything.type() == typeid(std::vector<int>));
+
+        std::vector<int>* ptr_vec = any_cast<std::vector<int>>(&anything);
+        REQUIRE(ptr_vec != nullptr);
+        CHECK(ptr_vec->size() == 3);
+
+        CHECK(any_cast<std::vector<int>&>(anything).data() == ptr_vec->data()); // no copy
+
+        anything.reset();
+        CHECK(anything.has_value() == false);
+    }
+
+    SECTION("pointer cast does not throw")
+    {
+        anything = 42;
+
+        CHECK(any_cast<int>(&anything) != nullptr);
+        CHECK(any_cast<long>(&anything) == nullptr);
+        CHECK(any_cast<int>(static_cast<SmallAny<>*>(nullptr)) == nullptr);
+
+        const SmallAny<>& const_anything = anything;
+        CHECK(*any_cast<int>(&const_anything) == 42);
+    }
+
+    SECTION("small objects are stored inline")
+    {
+        anything = "short text"s;
+        CHECK(anything.is_inline());
+
+        anything = std::array<char, 64>{};
+        CHECK_FALSE(anything.is_inline());
+
+        SmallAny<64> bigger_anything = std::array<char, 64>{};
+        CHECK(bigger_anything.is_inline());
+    }
+
+    SECTION("copy & move")
+    {
+        anything = "text"s;
+
+        SmallAny<> copy = anything;
+        CHECK(any_cast<std::string>(copy) == "text");
+        CHECK(any_cast<std::string>(anything) == "text");
+
+        SmallAny<> heap_value = std::array<int, 64>{1, 2, 3};
+        SmallAny<> heap_copy = heap_value;
+        CHECK(any_cast<std::array<int, 64>&>(heap_copy)[2] == 3);
+        CHECK(any_cast<std::array<int, 64>>(&heap_copy) != any_cast<std::array<int, 64>>(&heap_value));
+
+        SmallAny<> target = std::move(heap_value);
+        CHECK(heap_value.has_value() == false);
+        CHECK(any_cast<std::array<int, 64>&>(target)[1] == 2);
+    }
+
+    SECTION("emplace")
+    {
+        auto& str = anything.emplace<std::string>(3, 'a');
+
+        CHECK(str == "aaa");
+        CHECK(any_cast<std::string&>(anything) == "aaa");
+
+        SmallAny<> in_place{std::in_place_type<std::vector<int>>, 2, 7};
+        CHECK(any_cast<std::vector<int>>(in_place) == std::vector{7, 7});
+    }
+
+    SECTION("objects are destroyed")
+    {
+        auto sptr = std::make_shared<int>(42);
+
+        anything = sptr;
+        SmallAny<> copy = anything;
+        CHECK(sptr.use_count() == 3);
+
+        anything = 1;
+        copy.reset();
+        CHECK(sptr.use_count() == 1);
+    }
+
+    SECTION("assignment of its own contents")
+    {
+        const std::string long_text(100, 'x');
+
+        anything = long_text;
+        anything = *any_cast<std::string>(&anything);
+        CHECK(any_cast<std::string>(anything) == long_text);
+
+        anything = std::array<int, 64>{1, 2, 3};
+        anything = *any_cast<std::array<int, 64>>(&anything);
+        CHECK(any_cast<std::array<int, 64>&>(anything)[2] == 3);
+    }
+
+    SECTION("inline assignment does not allocate")
+    {
+        size_t allocations = allocations_during([&] {
+            anything = 42;
+            anything = 3.14;
+            anything = std::array<int, 8>{};
+            anything = "short text"s;
+        });
+
+        CHECK(allocations == 0);
+    }
+}
+
+TEST_CASE("UniqueAny")
+{
+    using ModernCpp::any_cast;
+    using ModernCpp::UniqueAny;
+
+    SECTION("holds move-only objects")
+    {
+        UniqueAny<> anything = std::make_unique<int>(42);
+
+        CHECK(anything.is_inline());
+        CHECK(**any_cast<std::unique_ptr<int>>(&anything) == 42);
+
+        UniqueAny<> target = std::move(anything);
+        CHECK_FALSE(anything.has_value());
+
+        std::unique_ptr<int> ptr = any_cast<std::unique_ptr<int>>(std::move(target));
+        CHECK(*ptr == 42);
+    }
+
+    SECTION("is not copyable")
+    {
+        static_assert(!std::is_copy_constructible_v<UniqueAny<>>);
+        static_assert(std::is_nothrow_move_constructible_v<UniqueAny<>>);
+        static_assert(std::is_copy_constructible_v<ModernCpp::SmallAny<>>);
+    }
+}
+
+TEST_CASE("SmallAny vs std::any", "[.][benchmark]")
+{
+    const std::string text = "medium sized text"; // bigger than std::any small buffer (one pointer in libstdc++)
+    const std::array<int, 6> coordinates{1, 2, 3, 4, 5, 6};
+
+    auto assign_values = [&](auto& anything) {
+        anything = 42;
+        anything = 3.14;
+        anything = text;
+        anything = coordinates;
+    };
+
+    std::any std_any;
+    ModernCpp::SmallAny<> small_any;
+
+    std::cout << "Allocations per 4 assignments - std::any: " << allocations_during([&] { assign_values(std_any); })
+              << ", SmallAny<32>: " << allocations_during([&] { assign_values(small_any); }) << "\n";
+
+    BENCHMARK("assignments - std::any")
+    {
+        assign_values(std_any);
+        return std_any.has_value();
+    };
+
+    BENCHMARK("assignments - SmallAny<32>")
+    {
+        assign_values(small_any);
+        return small_any.has_value();
+    };
+
+    std::vector<std::any> std_anys;
+    std::vector<ModernCpp::SmallAny<>> small_anys;
+    for (int i = 0; i < 1'000; ++i)
+    {
+        std_anys.emplace_back(i % 3 == 0 ? std::any{text} : std::any{i});
+        small_anys.emplace_back(i % 3 == 0 ? ModernCpp::SmallAny<>{text} : ModernCpp::SmallAny<>{i});
+    }
+
+    BENCHMARK("pointer cast - std::any")
+    {
+        long sum = 0;
+        for (auto& a : std_anys)
+            if (int* value = std::any_cast<int>(&a))
+                sum += *value;
+        return sum;
+    };
+
+    BENCHMARK("pointer cast - SmallAny<32>")
+    {
+        long sum = 0;
+        for (auto& a : small_anys)
+            if (int* value = ModernCpp::any_cast<int>(&a))
+                sum += *value;
+        return sum;
+    };
+}
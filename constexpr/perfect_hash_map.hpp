@@ -0,0 +1,280 @@
+#ifndef PERFECT_HASH_MAP_HPP
+#define PERFECT_HASH_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ModernCpp
+{
+    namespace Detail
+    {
+        // finalizer of MurmurHash3 - every input bit affects every output bit
+        constexpr uint64_t mix(uint64_t x) noexcept
+        {
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            x *= 0xC4CEB9FE1A85EC53ull;
+            x ^= x >> 33;
+            return x;
+        }
+    }
+
+    // Seeded hash used by PerfectHashMap - specialize it for other key types
+    template <typename T, typename = void>
+    struct PerfectHash;
+
+    template <typename T>
+    struct PerfectHash<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+    {
+        constexpr uint64_t operator()(T key, uint64_t seed) const noexcept
+        {
+            if constexpr (std::is_enum_v<T>)
+                return Detail::mix(static_cast<uint64_t>(static_cast<std::underlying_type_t<T>>(key)) ^ seed);
+            else
+                return Detail::mix(static_cast<uint64_t>(key) ^ seed);
+        }
+    };
+
+    template <>
+    struct PerfectHash<std::string_view>
+    {
+        // 8 bytes per step - the same value at compile time & at runtime (little-endian words)
+        constexpr uint64_t operator()(std::string_view key, uint64_t seed) const noexcept
+        {
+            uint64_t hash = seed ^ (key.size() * 0x9E3779B97F4A7C15ull);
+
+            while (key.size() >= 8)
+            {
+                hash = std::rotl((hash ^ load(key.data(), 8)) * 0x9E3779B97F4A7C15ull, 31);
+                key.remove_prefix(8);
+            }
+
+            if (!key.empty())
+                hash = std::rotl((hash ^ load(key.data(), key.size())) * 0x9E3779B97F4A7C15ull, 31);
+
+            return Detail::mix(hash);
+        }
+
+    private:
+        static constexpr uint64_t load(const char* data, size_t length) noexcept
+        {
+            if (!std::is_constant_evaluated() && length == 8 && std::endian::native == std::endian::little)
+            {
+                uint64_t word;
+                std::memcpy(&word, data, 8);
+                return word;
+            }
+
+            uint64_t word = 0;
+            for (size_t i = 0; i < length; ++i)
+                word |= static_cast<uint64_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+            return word;
+        }
+    };
+
+    // Immutable map for the fixed set of keys with the perfect hash function found at compile time:
+    // - hash & displace: a key is hashed once; its bucket keeps either the slot (single key buckets)
+    //   or the displacement that spreads keys of the bucket into free slots of the table
+    // - lookup: one hash, two array reads & one key comparison - no probing, no chains
+    // - table size is the power of 2 (slots not used by keys hold a copy of the first item, so they never match)
+    // - construction in constexpr context happens at compile time - the map is placed in read-only data
+    template <typename TKey, typename TValue, size_t N, typename THash = PerfectHash<TKey>>
+    class PerfectHashMap
+    {
+        static_assert(N > 0, "PerfectHashMap requires at least one item");
+
+    public:
+        using key_type = TKey;
+        using mapped_type = TValue;
+        using value_type = std::pair<TKey, TValue>;
+
+        static constexpr size_t table_size = std::bit_ceil(N);
+        static constexpr size_t bucket_count = table_size;
+
+    private:
+        static constexpr uint64_t max_seeds = 64;
+        static constexpr int32_t max_displacement = 1 << 20;
+
+        uint64_t seed_{};
+        std::array<int32_t, bucket_count> displacements_{}; // < 0: ~slot of the only key in the bucket
+        std::array<value_type, table_size> slots_{};
+        [[no_unique_address]] THash hash_{};
+
+        static constexpr size_t bucket_of(uint64_t hash) noexcept
+        {
+            return hash & (bucket_count - 1);
+        }
+
+        static constexpr size_t slot_of(uint64_t hash, int32_t displacement) noexcept
+        {
+            return Detail::mix(hash ^ (static_cast<uint64_t>(displacement) * 0x9E3779B97F4A7C15ull)) & (table_size - 1);
+        }
+
+        // false if keys with the same hash or a bucket without fitting displacement were found
+        constexpr bool try_build(const std::array<value_type, N>& items, uint64_t seed)
+        {
+            std::array<uint64_t, N> hashes{};
+            for (size_t i = 0; i < N; ++i)
+                hashes[i] = hash_(items[i].first, seed);
+
+            // counting sort of items by buckets
+            std::array<uint32_t, bucket_count + 1> offsets{};
+            for (uint64_t hash : hashes)
+                ++offsets[bucket_of(hash) + 1];
+            for (size_t b = 0; b < bucket_count; ++b)
+                offsets[b + 1] += offsets[b];
+
+            std::array<uint32_t, N> items_by_bucket{};
+            std::array<uint32_t, bucket_count> positions{};
+            std::copy(offsets.begin(), offsets.end() - 1, positions.begin());
+            for (uint32_t i = 0; i < N; ++i)
+                items_by_bucket[positions[bucket_of(hashes[i])]++] = i;
+
+            // the biggest buckets are placed first - when the table is still empty
+            std::array<uint32_t, bucket_count> buckets{};
+            for (uint32_t b = 0; b < bucket_count; ++b)
+                buckets[b] = b;
+            std::sort(buckets.begin(), buckets.end(), [&](uint32_t a, uint32_t b) {
+                return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b];
+            });
+
+            std::array<bool, table_size> is_occupied{};
+            std::array<size_t, N> bucket_slots{};
+            displacements_ = {};
+
+            size_t free_slot = 0;
+
+            for (uint32_t bucket : buckets)
+            {
+                const uint32_t first = offsets[bucket];
+                const uint32_t size = offsets[bucket + 1] - first;
+
+                if (size == 0)
+                    break;
+
+                if (size == 1)
+                {
+                    while (is_occupied[free_slot])
+                        ++free_slot;
+
+                    is_occupied[free_slot] = true;
+                    slots_[free_slot] = items[items_by_bucket[first]];
+                    displacements_[bucket] = ~static_cast<int32_t>(free_slot);
+                    continue;
+                }
+
+                for (uint32_t i = first; i < first + size; ++i)
+                    for (uint32_t j = first; j < i; ++j)
+                        if (hashes[items_by_bucket[i]] == hashes[items_by_bucket[j]])
+                        {
+                            if (items[items_by_bucket[i]].first == items[items_by_bucket[j]].first)
+                                throw std::invalid_argument{"PerfectHashMap: duplicated key"};
+                            return false; // collision of full hashes - other seed is needed
+                        }
+
+                int32_t displacement = 0;
+                for (; displacement < max_displacement; ++displacement)
+                {
+                    bool fits = true;
+
+                    for (uint32_t i = 0; i < size && fits; ++i)
+                    {
+                        bucket_slots[i] = slot_of(hashes[items_by_bucket[first + i]], displacement);
+                        fits = !is_occupied[bucket_slots[i]];
+                        for (uint32_t j = 0; j < i && fits; ++j)
+                            fits = bucket_slots[j] != bucket_slots[i];
+                    }
+
+                    if (fits)
+                        break;
+                }
+
+                if (displacement == max_displacement)
+                    return false;
+
+                for (uint32_t i = 0; i < size; ++i)
+                {
+                    is_occupied[bucket_slots[i]] = true;
+                    slots_[bucket_slots[i]] = items[items_by_bucket[first + i]];
+                }
+                displacements_[bucket] = displacement;
+            }
+
+            for (size_t slot = 0; slot < table_size; ++slot)
+                if (!is_occupied[slot])
+                    slots_[slot] = items[0];
+
+            return true;
+        }
+
+    public:
+        // throws std::invalid_argument for duplicated keys (compilation error in constexpr context)
+        constexpr explicit PerfectHashMap(const std::array<value_type, N>& items)
+        {
+            for (uint64_t seed = 0; seed < max_seeds; ++seed)
+            {
+                if (try_build(items, Detail::mix(seed + 1)))
+                {
+                    seed_ = Detail::mix(seed + 1);
+                    return;
+                }
+            }
+
+            throw std::invalid_argument{"PerfectHashMap: perfect hash function not found"};
+        }
+
+        constexpr size_t size() const noexcept
+        {
+            return N;
+        }
+
+        // nullptr if the key is not in the map
+        constexpr const TValue* find(const TKey& key) const noexcept
+        {
+            const uint64_t hash = hash_(key, seed_);
+            const int32_t displacement = displacements_[bucket_of(hash)];
+            const size_t slot = displacement < 0 ? static_cast<size_t>(~displacement) : slot_of(hash, displacement);
+
+            const value_type& item = slots_[slot];
+            return item.first == key ? &item.second : nullptr;
+        }
+
+        constexpr bool contains(const TKey& key) const noexcept
+        {
+            return find(key) != nullptr;
+        }
+
+        // throws std::out_of_range if the key is not in the map
+        constexpr const TValue& at(const TKey& key) const
+        {
+            if (const TValue* value = find(key))
+                return *value;
+
+            throw std::out_of_range{"PerfectHashMap: key not found"};
+        }
+    };
+
+    template <typename TKey, typename TValue, size_t N>
+    constexpr auto make_perfect_hash_map(const std::array<std::pair<TKey, TValue>, N>& items)
+    {
+        return PerfectHashMap<TKey, TValue, N>{items};
+    }
+
+    // constexpr auto colors = make_perfect_hash_map<std::string_view, int>({{"red", 1}, {"green", 2}});
+    template <typename TKey, typename TValue, size_t N>
+    constexpr auto make_perfect_hash_map(const std::pair<TKey, TValue> (&items)[N])
+    {
+        return PerfectHashMap<TKey, TValue, N>{std::to_array(items)};
+    }
+}
+
+#endif
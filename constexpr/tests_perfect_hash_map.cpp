@@ -0,0 +1,215 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "perfect_hash_map.hpp"
+#include <array>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace std::literals;
+
+using ModernCpp::make_perfect_hash_map;
+using ModernCpp::PerfectHashMap;
+
+namespace
+{
+    enum class Color
+    {
+        red,
+        green,
+        blue,
+        yellow = 42
+    };
+
+    constexpr auto color_names = make_perfect_hash_map<Color, std::string_view>({
+        {Color::red, "red"},
+        {Color::green, "green"},
+        {Color::blue, "blue"},
+        {Color::yellow, "yellow"},
+    });
+
+    constexpr auto config_keys = make_perfect_hash_map<std::string_view, int>({
+        {"max_connections", 100},
+        {"timeout_ms", 2500},
+        {"retries", 3},
+        {"port", 8080},
+        {"log_level", 2},
+        {"buffer_size", 65536},
+        {"compression", 1},
+    });
+}
+
+TEST_CASE("PerfectHashMap")
+{
+    SECTION("lookup at compile time")
+    {
+        static_assert(color_names.size() == 4);
+        static_assert(color_names.at(Color::green) == "green");
+        static_assert(color_names.at(Color::yellow) == "yellow");
+
+        static_assert(config_keys.at("port") == 8080);
+        static_assert(config_keys.contains("retries"));
+        static_assert(!config_keys.contains("unknown"));
+        static_assert(!config_keys.contains("")); // empty slots never match
+    }
+
+    SECTION("lookup at runtime")
+    {
+        std::string key = "timeout_ms";
+
+        const int* timeout = config_keys.find(key);
+        REQUIRE(timeout != nullptr);
+        CHECK(*timeout == 2500);
+
+        CHECK(config_keys.find("timeout") == nullptr);
+        CHECK(color_names.find(static_cast<Color>(3)) == nullptr);
+    }
+
+    SECTION("at throws for unknown key")
+    {
+        CHECK_THROWS_AS(config_keys.at("unknown"), std::out_of_range);
+    }
+
+    SECTION("duplicated keys are rejected")
+    {
+        std::array<std::pair<int, int>, 3> items{{{1, 1}, {2, 2}, {1, 3}}};
+
+        CHECK_THROWS_AS((PerfectHashMap<int, int, 3>{items}), std::invalid_argument);
+    }
+
+    SECTION("many keys")
+    {
+        std::array<std::pair<int, int>, 1000> items{};
+        for (int i = 0; i < 1000; ++i)
+            items[i] = {i * 7919, i};
+
+        auto map = make_perfect_hash_map(items);
+
+        for (const auto& [key, value] : items)
+            CHECK(map.at(key) == value);
+
+        for (int i = 0; i < 1000; ++i)
+            CHECK_FALSE(map.contains(i * 7919 + 1));
+    }
+}
+
+////////////////////////////////////////////////////////////
+// benchmark - key sets generated at compile time
+
+namespace
+{
+    constexpr size_t max_key_length = 24;
+
+    // "setting.<name>.<number>" - keys with common prefix, as in configuration files
+    template <size_t N>
+    constexpr auto make_key_names()
+    {
+        constexpr std::string_view prefix = "setting.";
+        constexpr std::string_view names[] = {"network", "storage", "display", "audio", "input", "cache"};
+
+        std::array<std::array<char, max_key_length>, N> keys{};
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            auto& key = keys[i];
+            size_t length = 0;
+
+            for (char c : prefix)
+                key[length++] = c;
+            for (char c : names[i % std::size(names)])
+                key[length++] = c;
+            key[length++] = '.';
+
+            char digits[8]{};
+            size_t no_of_digits = 0;
+            for (size_t number = i; no_of_digits == 0 || number > 0; number /= 10)
+                digits[no_of_digits++] = static_cast<char>('0' + number % 10);
+            while (no_of_digits > 0)
+                key[length++] = digits[--no_of_digits];
+        }
+
+        return keys;
+    }
+
+    template <size_t N>
+    constexpr auto key_names = make_key_names<N>();
+
+    template <size_t N>
+    constexpr auto make_items()
+    {
+        std::array<std::pair<std::string_view, int>, N> items{};
+        for (size_t i = 0; i < N; ++i)
+            items[i] = {std::string_view{key_names<N>[i].data()}, static_cast<int>(i)};
+        return items;
+    }
+
+    // built at compile time - hash & displace search for thousands of keys costs seconds of compilation,
+    // so big key sets are built at runtime by the benchmark (lookup is the same code)
+    template <size_t N>
+    constexpr auto perfect_hash_map = make_perfect_hash_map(make_items<N>());
+
+    template <size_t N, typename TPerfectHashMap>
+    void benchmark_lookups(const TPerfectHashMap& perfect_map)
+    {
+        const auto items = make_items<N>(); // runtime - big key sets are slow to generate in constant evaluation
+
+        std::map<std::string_view, int> map(items.begin(), items.end());
+        std::unordered_map<std::string_view, int> hash_map(items.begin(), items.end());
+
+        std::mt19937 rnd{42};
+        std::vector<std::string> queries(4096); // copies - keys are not compared by pointers
+        for (auto& query : queries)
+            query = items[rnd() % N].first;
+
+        const std::string suffix = " - " + std::to_string(N) + " keys";
+
+        BENCHMARK("std::map" + suffix)
+        {
+            long sum = 0;
+            for (const auto& query : queries)
+                sum += map.find(query)->second;
+            return sum;
+        };
+
+        BENCHMARK("std::unordered_map" + suffix)
+        {
+            long sum = 0;
+            for (const auto& query : queries)
+                sum += hash_map.find(query)->second;
+            return sum;
+        };
+
+        BENCHMARK("PerfectHashMap" + suffix)
+        {
+            long sum = 0;
+            for (const auto& query : queries)
+                sum += *perfect_map.find(query);
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("PerfectHashMap - generated key sets")
+{
+    static_assert(perfect_hash_map<256>.at("setting.network.0") == 0);
+    static_assert(perfect_hash_map<256>.at("setting.cache.251") == 251);
+
+    for (const auto& [key, value] : make_items<256>())
+        CHECK(perfect_hash_map<256>.at(key) == value);
+}
+
+TEST_CASE("PerfectHashMap vs std::map & std::unordered_map", "[.][benchmark]")
+{
+    benchmark_lookups<16>(perfect_hash_map<16>);
+    benchmark_lookups<256>(perfect_hash_map<256>);
+
+    const auto big_perfect_hash_map = make_perfect_hash_map(make_items<4096>()); // runtime
+    for (const auto& [key, value] : make_items<4096>())
+        REQUIRE(big_perfect_hash_map.at(key) == value);
+
+    benchmark_lookups<4096>(big_perfect_hash_map);
+}
@@ -1,4 +1,5 @@
 #include <catch2/catch_test_macros.hpp>
+#include "thread_pool.hpp"
 #include <iostream>
 #include <string>
 #include <vector>
@@ -305,6 +306,22 @@ TEST_CASE("tasks with lambdas & std::function")
     }
 }
 
+TEST_CASE("tasks with lambdas & thread pool")
+{
+    Printer prn;
+
+    {
+        Concurrency::ThreadPool pool{1};
+
+        pool.submit([&prn] { prn.on(); });
+        pool.submit([&prn] { prn.print();});
+        pool.submit([&prn] { prn.off();});
+        pool.submit([ptr = std::make_unique<int>(42)] { std::cout << "Move-only task: " << *ptr << "\n"; });
+    } // all tasks are done when pool is destroyed
+
+    std::cout << "-----------\n";
+}
+
 TEST_CASE("magic plus for lambda")
 {
     auto square_1 = [](int x) { return x * x; }; // type deduction works
@@ -0,0 +1,128 @@
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Concurrency
+{
+    inline constexpr size_t cache_line_size = 64;
+
+    // Bounded lock-free multi-producer/multi-consumer queue (D. Vyukov's ring buffer)
+    // - every cell has a sequence number that tells producers & consumers whose turn it is
+    // - push/pop cost one CAS on the shared position + one release store on the cell
+    template <typename T>
+    class BoundedMpmcQueue
+    {
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            alignas(T) std::byte storage[sizeof(T)];
+
+            T* item()
+            {
+                return std::launder(reinterpret_cast<T*>(storage));
+            }
+        };
+
+        std::unique_ptr<Cell[]> buffer_;
+        size_t mask_;
+
+        alignas(cache_line_size) std::atomic<size_t> enqueue_pos_{0};
+        alignas(cache_line_size) std::atomic<size_t> dequeue_pos_{0};
+
+    public:
+        // capacity is rounded up to the power of 2
+        explicit BoundedMpmcQueue(size_t capacity)
+            : buffer_{std::make_unique<Cell[]>(std::bit_ceil(capacity < 2 ? size_t{2} : capacity))}
+            , mask_{std::bit_ceil(capacity < 2 ? size_t{2} : capacity) - 1}
+        {
+            for (size_t i = 0; i <= mask_; ++i)
+                buffer_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+        BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+        ~BoundedMpmcQueue()
+        {
+            size_t last = enqueue_pos_.load(std::memory_order_relaxed);
+            for (size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != last; ++pos)
+                std::destroy_at(buffer_[pos & mask_].item());
+        }
+
+        size_t capacity() const
+        {
+            return mask_ + 1;
+        }
+
+        // item is moved (or copied) only if there is a free cell in the queue
+        template <typename TItem>
+        bool try_push(TItem&& item)
+        {
+            size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                Cell& cell = buffer_[pos & mask_];
+                size_t seq = cell.sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        new (cell.storage) T(std::forward<TItem>(item));
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // queue is full
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool try_pop(T& item)
+        {
+            size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                Cell& cell = buffer_[pos & mask_];
+                size_t seq = cell.sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        item = std::move(*cell.item());
+                        std::destroy_at(cell.item());
+                        cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // queue is empty
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+}
+
+#endif
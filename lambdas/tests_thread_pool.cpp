@@ -0,0 +1,247 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "mpmc_queue.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("BoundedMpmcQueue")
+{
+    using namespace Concurrency;
+
+    SECTION("capacity is rounded up to the power of 2")
+    {
+        BoundedMpmcQueue<int> q{100};
+
+        CHECK(q.capacity() == 128);
+    }
+
+    SECTION("FIFO order for single thread")
+    {
+        BoundedMpmcQueue<int> q{4};
+
+        CHECK(q.try_push(1));
+        CHECK(q.try_push(2));
+        CHECK(q.try_push(3));
+
+        int value{};
+        REQUIRE(q.try_pop(value));
+        CHECK(value == 1);
+        REQUIRE(q.try_pop(value));
+        CHECK(value == 2);
+        REQUIRE(q.try_pop(value));
+        CHECK(value == 3);
+        CHECK_FALSE(q.try_pop(value));
+    }
+
+    SECTION("push into full queue fails & leaves the item intact")
+    {
+        BoundedMpmcQueue<std::unique_ptr<int>> q{2};
+
+        CHECK(q.try_push(std::make_unique<int>(1)));
+        CHECK(q.try_push(std::make_unique<int>(2)));
+
+        auto item = std::make_unique<int>(3);
+        CHECK_FALSE(q.try_push(std::move(item)));
+        REQUIRE(item != nullptr);
+        CHECK(*item == 3);
+    }
+
+    SECTION("items left in queue are destroyed")
+    {
+        auto ptr = std::make_shared<int>(42);
+
+        {
+            BoundedMpmcQueue<std::shared_ptr<int>> q{8};
+            q.try_push(ptr);
+            q.try_push(ptr);
+            CHECK(ptr.use_count() == 3);
+        }
+
+        CHECK(ptr.use_count() == 1);
+    }
+
+    SECTION("many producers & many consumers")
+    {
+        constexpr int no_of_producers = 4;
+        constexpr int no_of_consumers = 4;
+        constexpr int items_per_producer = 100'000;
+
+        BoundedMpmcQueue<int> q{1024};
+        std::atomic<long long> sum{0};
+        std::atomic<int> consumed{0};
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < no_of_producers; ++p)
+            threads.emplace_back([&q] {
+                for (int i = 1; i <= items_per_producer; ++i)
+                    while (!q.try_push(i))
+                        std::this_thread::yield();
+            });
+
+        for (int c = 0; c < no_of_consumers; ++c)
+            threads.emplace_back([&] {
+                int value;
+                while (consumed.load() < no_of_producers * items_per_producer)
+                {
+                    if (q.try_pop(value))
+                    {
+                        sum += value;
+                        ++consumed;
+                    }
+                }
+            });
+
+        for (auto& thd : threads)
+            thd.join();
+
+        CHECK(sum == no_of_producers * (items_per_producer * (items_per_producer + 1LL) / 2));
+    }
+}
+
+TEST_CASE("ThreadPool")
+{
+    using namespace Concurrency;
+
+    SECTION("all submitted tasks are executed before destruction")
+    {
+        std::atomic<int> counter{0};
+
+        {
+            ThreadPool pool{4, 16};
+
+            for (int i = 0; i < 10'000; ++i)
+                pool.submit([&counter] { ++counter; });
+        }
+
+        CHECK(counter == 10'000);
+    }
+
+    SECTION("tasks submitted from many threads")
+    {
+        std::atomic<int> counter{0};
+
+        {
+            ThreadPool pool{2};
+
+            std::vector<std::thread> producers;
+            for (int p = 0; p < 4; ++p)
+                producers.emplace_back([&pool, &counter] {
+                    for (int i = 0; i < 10'000; ++i)
+                        pool.submit([&counter] { ++counter; });
+                });
+
+            for (auto& thd : producers)
+                thd.join();
+        }
+
+        CHECK(counter == 40'000);
+    }
+}
+
+namespace
+{
+    // the baseline - global std::queue<Task> guarded by mutex
+    class MutexQueuePool
+    {
+        std::queue<Concurrency::Task> tasks_;
+        std::mutex mtx_;
+        std::condition_variable cv_;
+        bool done_ = false;
+        std::vector<std::thread> workers_;
+
+    public:
+        explicit MutexQueuePool(size_t no_of_workers)
+        {
+            for (size_t i = 0; i < no_of_workers; ++i)
+                workers_.emplace_back([this] {
+                    while (true)
+                    {
+                        Concurrency::Task task;
+                        {
+                            std::unique_lock lk{mtx_};
+                            cv_.wait(lk, [this] { return done_ || !tasks_.empty(); });
+                            if (tasks_.empty())
+                                return;
+                            task = std::move(tasks_.front());
+                            tasks_.pop();
+                        }
+                        task();
+                    }
+                });
+        }
+
+        ~MutexQueuePool()
+        {
+            {
+                std::lock_guard lk{mtx_};
+                done_ = true;
+            }
+            cv_.notify_all();
+
+            for (auto& worker : workers_)
+                worker.join();
+        }
+
+        template <typename TCallable>
+        void submit(TCallable&& task)
+        {
+            {
+                std::lock_guard lk{mtx_};
+                tasks_.emplace(std::forward<TCallable>(task));
+            }
+            cv_.notify_one();
+        }
+    };
+
+    template <typename TPool>
+    void produce_tasks(TPool& pool, int no_of_producers, int no_of_tasks, std::atomic<int>& counter)
+    {
+        std::vector<std::thread> producers;
+        for (int p = 0; p < no_of_producers; ++p)
+            producers.emplace_back([&pool, &counter, tasks_per_producer = no_of_tasks / no_of_producers] {
+                for (int i = 0; i < tasks_per_producer; ++i)
+                    pool.submit([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+            });
+
+        for (auto& thd : producers)
+            thd.join();
+
+        while (counter.load() < no_of_tasks)
+            std::this_thread::yield();
+    }
+}
+
+TEST_CASE("task queue throughput", "[.][benchmark]")
+{
+    constexpr int no_of_tasks = 160'000; // divisible by all numbers of producers
+    const size_t no_of_workers = std::max(2u, std::thread::hardware_concurrency() / 2);
+
+    Concurrency::ThreadPool lock_free_pool{no_of_workers};
+    MutexQueuePool mutex_pool{no_of_workers};
+
+    for (int no_of_producers : {1, 2, 4, 8, 16})
+    {
+        BENCHMARK("lock-free MPMC queue - producers: " + std::to_string(no_of_producers))
+        {
+            std::atomic<int> counter{0};
+            produce_tasks(lock_free_pool, no_of_producers, no_of_tasks, counter);
+            return counter.load();
+        };
+
+        BENCHMARK("mutex + std::queue - producers: " + std::to_string(no_of_producers))
+        {
+            std::atomic<int> counter{0};
+            produce_tasks(mutex_pool, no_of_producers, no_of_tasks, counter);
+            return counter.load();
+        };
+    }
+}
@@ -0,0 +1,160 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "allocation_counter.hpp"
+#include "unique_function.hpp"
+#include <array>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST_CASE("UniqueFunction")
+{
+    using Concurrency::UniqueFunction;
+
+    SECTION("default constructed is empty")
+    {
+        UniqueFunction<void()> f;
+
+        CHECK_FALSE(f);
+        CHECK_THROWS_AS(f(), std::bad_function_call);
+    }
+
+    SECTION("stores lambdas, functions & function pointers")
+    {
+        UniqueFunction<int(int)> f = [factor = 2](int x) { return factor * x; };
+        CHECK(f(3) == 6);
+
+        int (*square)(int) = [](int x) { return x * x; };
+        f = square;
+        CHECK(f(4) == 16);
+
+        f = nullptr;
+        CHECK_FALSE(f);
+    }
+
+    SECTION("result is discarded for void signature")
+    {
+        int counter = 0;
+
+        UniqueFunction<void()> inline_f = [&counter] { return ++counter; };
+        inline_f();
+
+        UniqueFunction<void(), 8> heap_f = [&counter, padding = std::array<char, 32>{}] { return ++counter + padding[0]; };
+        heap_f();
+
+        CHECK(counter == 2);
+    }
+
+    SECTION("result is converted to the return type of the signature")
+    {
+        UniqueFunction<long(int)> f = [](int x) { return static_cast<short>(x * 2); };
+
+        CHECK(f(21) == 42L);
+    }
+
+    SECTION("stores move-only callables")
+    {
+        auto uptr = std::make_unique<int>(42);
+        auto lambda_with_movable_object = [lambda_ptr = std::move(uptr)]() { return *lambda_ptr; };
+
+        UniqueFunction<int()> f = std::move(lambda_with_movable_object);
+        CHECK(f() == 42);
+
+        UniqueFunction<int()> target = std::move(f);
+        CHECK_FALSE(f);
+        CHECK(target() == 42);
+    }
+
+    SECTION("mutable state is kept between calls")
+    {
+        UniqueFunction<int()> generator = [seed = 0]() mutable { return ++seed; };
+
+        CHECK(generator() == 1);
+        CHECK(generator() == 2);
+    }
+
+    SECTION("small callables are stored inline - no allocation")
+    {
+        std::array<int, 8> data{1, 2, 3, 4, 5, 6, 7, 8};
+
+        size_t allocations = allocations_during([&] {
+            UniqueFunction<int()> f = [data] { return data[7]; };
+            REQUIRE(f.is_inline());
+
+            UniqueFunction<int()> moved_f = std::move(f);
+            CHECK(moved_f() == 8);
+        });
+
+        CHECK(allocations == 0);
+    }
+
+    SECTION("inline capacity is configurable")
+    {
+        std::array<int, 32> big_data{};
+
+        UniqueFunction<size_t()> default_f = [big_data] { return big_data.size(); };
+        CHECK_FALSE(default_f.is_inline());
+        CHECK(default_f() == 32);
+
+        UniqueFunction<size_t(), 128> big_f = [big_data] { return big_data.size(); };
+        CHECK(big_f.is_inline());
+        CHECK(big_f() == 32);
+    }
+
+    SECTION("captured objects are destroyed")
+    {
+        auto sptr = std::make_shared<int>(42);
+
+        {
+            UniqueFunction<void()> f = [sptr] {};
+            UniqueFunction<void()> g = std::move(f);
+            CHECK(sptr.use_count() == 2);
+        }
+
+        CHECK(sptr.use_count() == 1);
+    }
+}
+
+TEST_CASE("std::function vs. UniqueFunction", "[.][benchmark]")
+{
+    using Concurrency::UniqueFunction;
+
+    std::array<int, 8> captured{1, 2, 3, 4, 5, 6, 7, 8}; // 32 bytes - too big for std::function's buffer
+    auto task = [captured] { return captured[0] + captured[7]; };
+
+    size_t std_function_allocations = allocations_during([&] { std::function<int()> f = task; });
+    size_t unique_function_allocations = allocations_during([&] { UniqueFunction<int()> f = task; });
+
+    std::cout << "Allocations per task - std::function: " << std_function_allocations
+              << ", UniqueFunction: " << unique_function_allocations << "\n";
+
+    constexpr size_t no_of_tasks = 1'000;
+
+    BENCHMARK("std::function - create & call")
+    {
+        std::vector<std::function<int()>> tasks;
+        tasks.reserve(no_of_tasks);
+        for (size_t i = 0; i < no_of_tasks; ++i)
+            tasks.emplace_back(task);
+
+        int result = 0;
+        for (auto& t : tasks)
+            result += t();
+        return result;
+    };
+
+    BENCHMARK("UniqueFunction - create & call")
+    {
+        std::vector<UniqueFunction<int()>> tasks;
+        tasks.reserve(no_of_tasks);
+        for (size_t i = 0; i < no_of_tasks; ++i)
+            tasks.emplace_back(task);
+
+        int result = 0;
+        for (auto& t : tasks)
+            result += t();
+        return result;
+    };
+}
@@ -0,0 +1,226 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "work_stealing_deque.hpp"
+#include "work_stealing_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("WorkStealingDeque")
+{
+    using namespace Concurrency;
+
+    std::vector<int> items(100);
+    std::iota(items.begin(), items.end(), 0);
+
+    SECTION("owner pops in LIFO order")
+    {
+        WorkStealingDeque<int> dq{4};
+
+        dq.push(&items[1]);
+        dq.push(&items[2]);
+        dq.push(&items[3]);
+
+        CHECK(dq.pop() == &items[3]);
+        CHECK(dq.pop() == &items[2]);
+        CHECK(dq.pop() == &items[1]);
+        CHECK(dq.pop() == nullptr);
+        CHECK(dq.empty());
+    }
+
+    SECTION("thief steals in FIFO order")
+    {
+        WorkStealingDeque<int> dq{4};
+
+        dq.push(&items[1]);
+        dq.push(&items[2]);
+
+        CHECK(dq.steal() == &items[1]);
+        CHECK(dq.pop() == &items[2]);
+        CHECK(dq.steal() == nullptr);
+    }
+
+    SECTION("buffer grows when full")
+    {
+        WorkStealingDeque<int> dq{2};
+
+        for (auto& item : items)
+            dq.push(&item);
+
+        for (auto it = items.rbegin(); it != items.rend(); ++it)
+            CHECK(dq.pop() == &*it);
+    }
+
+    SECTION("every item is taken exactly once - owner vs. thieves")
+    {
+        constexpr int no_of_items = 200'000;
+        std::vector<int> values(no_of_items, 1);
+        std::vector<std::atomic<int>> taken(no_of_items);
+
+        WorkStealingDeque<int> dq{64};
+        std::atomic<bool> owner_done{false};
+
+        auto take = [&](int* item) { ++taken[item - values.data()]; };
+
+        std::vector<std::thread> thieves;
+        for (int i = 0; i < 3; ++i)
+            thieves.emplace_back([&] {
+                while (!owner_done.load() || !dq.empty())
+                    if (int* item = dq.steal())
+                        take(item);
+            });
+
+        for (int i = 0; i < no_of_items; ++i)
+        {
+            dq.push(&values[i]);
+            if (i % 3 == 0)
+                if (int* item = dq.pop())
+                    take(item);
+        }
+
+        while (int* item = dq.pop())
+            take(item);
+
+        owner_done = true;
+        for (auto& thd : thieves)
+            thd.join();
+
+        CHECK(std::all_of(taken.begin(), taken.end(), [](const auto& counter) { return counter.load() == 1; }));
+    }
+}
+
+namespace
+{
+    long long parallel_sum(Concurrency::WorkStealingPool& pool, const int* first, const int* last, size_t cutoff)
+    {
+        size_t size = last - first;
+        if (size <= cutoff)
+            return std::accumulate(first, last, 0LL);
+
+        const int* middle = first + size / 2;
+        long long left_sum{}, right_sum{};
+
+        pool.fork_join(
+            [&] { left_sum = parallel_sum(pool, first, middle, cutoff); },
+            [&] { right_sum = parallel_sum(pool, middle, last, cutoff); });
+
+        return left_sum + right_sum;
+    }
+
+    int fibonacci(Concurrency::WorkStealingPool& pool, int n)
+    {
+        if (n < 2)
+            return n;
+
+        int a{}, b{};
+        pool.fork_join([&] { a = fibonacci(pool, n - 1); }, [&] { b = fibonacci(pool, n - 2); });
+
+        return a + b;
+    }
+}
+
+TEST_CASE("WorkStealingPool")
+{
+    using namespace Concurrency;
+
+    SECTION("submitted tasks are executed before destruction")
+    {
+        std::atomic<int> counter{0};
+
+        {
+            WorkStealingPool pool{4};
+
+            for (int i = 0; i < 10'000; ++i)
+                pool.submit([&counter] { ++counter; });
+        }
+
+        CHECK(counter == 10'000);
+    }
+
+    SECTION("exception thrown by submitted task is discarded")
+    {
+        std::atomic<int> counter{0};
+
+        {
+            WorkStealingPool pool{2};
+
+            for (int i = 0; i < 100; ++i)
+                pool.submit([&counter, i] {
+                    if (i % 2 == 0)
+                        throw std::runtime_error{"error"};
+                    ++counter;
+                });
+        }
+
+        CHECK(counter == 50);
+    }
+
+    SECTION("tasks can spawn nested tasks")
+    {
+        std::atomic<int> counter{0};
+
+        {
+            WorkStealingPool pool{4};
+
+            for (int i = 0; i < 100; ++i)
+                pool.submit([&pool, &counter] {
+                    for (int j = 0; j < 100; ++j)
+                        pool.submit([&counter] { ++counter; });
+                });
+        }
+
+        CHECK(counter == 10'000);
+    }
+
+    SECTION("fork_join - recursive fibonacci")
+    {
+        WorkStealingPool pool{4};
+
+        CHECK(fibonacci(pool, 20) == 6765);
+    }
+
+    SECTION("fork_join - parallel sum")
+    {
+        WorkStealingPool pool{4};
+
+        std::vector<int> data(1'000'000);
+        std::iota(data.begin(), data.end(), 0);
+
+        CHECK(parallel_sum(pool, data.data(), data.data() + data.size(), 1'000) == 999'999LL * 1'000'000 / 2);
+    }
+
+    SECTION("fork_join propagates exceptions")
+    {
+        WorkStealingPool pool{2};
+
+        CHECK_THROWS_AS(pool.fork_join([] {}, [] { throw std::runtime_error{"error"}; }), std::runtime_error);
+        CHECK_THROWS_AS(pool.fork_join([] { throw std::runtime_error{"error"}; }, [] {}), std::runtime_error);
+    }
+}
+
+TEST_CASE("work-stealing pool scaling", "[.][benchmark]")
+{
+    std::vector<int> data(16'000'000);
+    std::iota(data.begin(), data.end(), 0);
+
+    const size_t max_no_of_workers = std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t no_of_workers = 1; no_of_workers <= max_no_of_workers; no_of_workers *= 2)
+    {
+        Concurrency::WorkStealingPool pool{no_of_workers};
+
+        BENCHMARK("parallel sum (fork_join) - workers: " + std::to_string(no_of_workers))
+        {
+            return parallel_sum(pool, data.data(), data.data() + data.size(), 16 * 1024);
+        };
+
+        BENCHMARK("fibonacci(25) (fork_join) - workers: " + std::to_string(no_of_workers))
+        {
+            return fibonacci(pool, 25);
+        };
+    }
+}
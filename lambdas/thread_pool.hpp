@@ -0,0 +1,125 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include "mpmc_queue.hpp"
+#include "unique_function.hpp"
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace Concurrency
+{
+    // Pool of workers draining a bounded lock-free MPMC queue of tasks
+    // - submit() from any number of threads (back-pressure: spins when the queue is full)
+    // - idle workers spin shortly and then sleep on an atomic wait
+    // - destructor executes all submitted tasks before joining workers
+    class ThreadPool
+    {
+        BoundedMpmcQueue<Task> tasks_;
+        std::vector<std::thread> workers_;
+
+        std::atomic<bool> done_{false};
+        alignas(cache_line_size) std::atomic<unsigned> wake_up_signal_{0};
+        alignas(cache_line_size) std::atomic<size_t> sleeping_workers_{0};
+
+        static constexpr int spins_before_sleep = 64;
+
+    public:
+        explicit ThreadPool(size_t no_of_workers = std::thread::hardware_concurrency(), size_t queue_capacity = 64 * 1024)
+            : tasks_{queue_capacity}
+        {
+            if (no_of_workers == 0)
+                no_of_workers = 1;
+
+            workers_.reserve(no_of_workers);
+            for (size_t i = 0; i < no_of_workers; ++i)
+                workers_.emplace_back([this] { run(); });
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool()
+        {
+            done_.store(true);
+            wake_up_signal_.fetch_add(1);
+            wake_up_signal_.notify_all();
+
+            for (auto& worker : workers_)
+                worker.join();
+        }
+
+        size_t size() const
+        {
+            return workers_.size();
+        }
+
+        template <typename TCallable>
+        void submit(TCallable&& task)
+        {
+            Task t{std::forward<TCallable>(task)};
+
+            while (!tasks_.try_push(std::move(t)))
+                std::this_thread::yield();
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleeping_workers_.load(std::memory_order_relaxed) > 0)
+            {
+                wake_up_signal_.fetch_add(1, std::memory_order_release);
+                wake_up_signal_.notify_one();
+            }
+        }
+
+    private:
+        void run()
+        {
+            Task task;
+            int spins = 0;
+
+            while (true)
+            {
+                if (tasks_.try_pop(task))
+                {
+                    task();
+                    task = nullptr;
+                    spins = 0;
+                    continue;
+                }
+
+                if (done_.load())
+                    break;
+
+                if (++spins < spins_before_sleep)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                sleeping_workers_.fetch_add(1);
+                unsigned signal = wake_up_signal_.load();
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (tasks_.try_pop(task))
+                {
+                    sleeping_workers_.fetch_sub(1);
+                    task();
+                    task = nullptr;
+                }
+                else if (!done_.load())
+                {
+                    wake_up_signal_.wait(signal);
+                    sleeping_workers_.fetch_sub(1);
+                }
+                else
+                {
+                    sleeping_workers_.fetch_sub(1);
+                }
+
+                spins = 0;
+            }
+        }
+    };
+}
+
+#endif
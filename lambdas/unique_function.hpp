@@ -0,0 +1,207 @@
+#ifndef UNIQUE_FUNCTION_HPP
+#define UNIQUE_FUNCTION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Concurrency
+{
+    template <typename TSignature, size_t InlineSize = 48>
+    class UniqueFunction;
+
+    // Move-only replacement for std::function:
+    // - accepts move-only callables (e.g. lambdas capturing std::unique_ptr)
+    // - callables up to InlineSize bytes (nothrow movable) are stored in the object - no allocation
+    // - bigger callables are allocated on the heap
+    template <typename R, typename... TArgs, size_t InlineSize>
+    class UniqueFunction<R(TArgs...), InlineSize>
+    {
+        struct VTable
+        {
+            R (*invoke)(void* storage, TArgs&&... args);
+            void (*move_to)(void* source, void* target) noexcept; // move-constructs target & destroys source
+            void (*destroy)(void* storage) noexcept;
+            bool is_inline;
+        };
+
+        template <typename F>
+        static constexpr bool is_stored_inline = sizeof(F) <= InlineSize
+            && alignof(F) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<F>;
+
+        // like std::invoke_r - result of the callable is discarded for R = void (as in std::function<void(...)>)
+        template <typename F>
+        static R invoke_r(F& f, TArgs&&... args)
+        {
+            if constexpr (std::is_void_v<R>)
+                std::invoke(f, std::forward<TArgs>(args)...);
+            else
+                return std::invoke(f, std::forward<TArgs>(args)...);
+        }
+
+        template <typename F>
+        struct InlineStorage
+        {
+            static F* get(void* storage)
+            {
+                return std::launder(static_cast<F*>(storage));
+            }
+
+            static R invoke(void* storage, TArgs&&... args)
+            {
+                return invoke_r(*get(storage), std::forward<TArgs>(args)...);
+            }
+
+            static void move_to(void* source, void* target) noexcept
+            {
+                new (target) F(std::move(*get(source)));
+                std::destroy_at(get(source));
+            }
+
+            static void destroy(void* storage) noexcept
+            {
+                std::destroy_at(get(storage));
+            }
+
+            static constexpr VTable vtable{&invoke, &move_to, &destroy, true};
+        };
+
+        template <typename F>
+        struct HeapStorage
+        {
+            static F*& get(void* storage)
+            {
+                return *std::launder(static_cast<F**>(storage));
+            }
+
+            static R invoke(void* storage, TArgs&&... args)
+            {
+                return invoke_r(*get(storage), std::forward<TArgs>(args)...);
+            }
+
+            static void move_to(void* source, void* target) noexcept
+            {
+                new (target) F*(get(source));
+            }
+
+            static void destroy(void* storage) noexcept
+            {
+                delete get(storage);
+            }
+
+            static constexpr VTable vtable{&invoke, &move_to, &destroy, false};
+        };
+
+        alignas(std::max_align_t) std::byte storage_[InlineSize < sizeof(void*) ? sizeof(void*) : InlineSize];
+        const VTable* vtable_{nullptr};
+
+    public:
+        static constexpr size_t inline_capacity = InlineSize;
+
+        UniqueFunction() noexcept = default;
+
+        UniqueFunction(std::nullptr_t) noexcept
+        {
+        }
+
+        template <typename TCallable, typename F = std::decay_t<TCallable>,
+            typename = std::enable_if_t<!std::is_same_v<F, UniqueFunction> && std::is_invocable_r_v<R, F&, TArgs...>>>
+        UniqueFunction(TCallable&& callable)
+        {
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            {
+                if (callable == nullptr)
+                    return;
+            }
+
+            if constexpr (is_stored_inline<F>)
+            {
+                new (storage_) F(std::forward<TCallable>(callable));
+                vtable_ = &InlineStorage<F>::vtable;
+            }
+            else
+            {
+                new (storage_) F*(new F(std::forward<TCallable>(callable)));
+                vtable_ = &HeapStorage<F>::vtable;
+            }
+        }
+
+        UniqueFunction(const UniqueFunction&) = delete;
+        UniqueFunction& operator=(const UniqueFunction&) = delete;
+
+        UniqueFunction(UniqueFunction&& other) noexcept
+            : vtable_{std::exchange(other.vtable_, nullptr)}
+        {
+            if (vtable_)
+                vtable_->move_to(other.storage_, storage_);
+        }
+
+        UniqueFunction& operator=(UniqueFunction&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+
+                vtable_ = std::exchange(other.vtable_, nullptr);
+                if (vtable_)
+                    vtable_->move_to(other.storage_, storage_);
+            }
+
+            return *this;
+        }
+
+        UniqueFunction& operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        template <typename TCallable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TCallable>, UniqueFunction>>>
+        UniqueFunction& operator=(TCallable&& callable)
+        {
+            UniqueFunction temp{std::forward<TCallable>(callable)};
+            *this = std::move(temp);
+
+            return *this;
+        }
+
+        ~UniqueFunction()
+        {
+            reset();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return vtable_ != nullptr;
+        }
+
+        R operator()(TArgs... args)
+        {
+            if (!vtable_)
+                throw std::bad_function_call{};
+
+            return vtable_->invoke(storage_, std::forward<TArgs>(args)...);
+        }
+
+        // true if the stored callable is kept in the small buffer
+        bool is_inline() const noexcept
+        {
+            return vtable_ != nullptr && vtable_->is_inline;
+        }
+
+    private:
+        void reset() noexcept
+        {
+            if (vtable_)
+                std::exchange(vtable_, nullptr)->destroy(storage_);
+        }
+    };
+
+    using Task = UniqueFunction<void()>;
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include "mpmc_queue.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Concurrency
+{
+    // Chase-Lev work-stealing deque of pointers (C11 memory model version by Le, Pop, Cohen & Zappa Nardelli)
+    // - the owner thread pushes & pops at the bottom (LIFO - hot caches for nested tasks)
+    // - any other thread steals from the top (FIFO - the oldest, usually the biggest chunks of work)
+    // - the buffer grows when full; retired buffers are kept until the deque is destroyed
+    //   because thieves may still read from them
+    template <typename T>
+    class WorkStealingDeque
+    {
+        class RingBuffer
+        {
+            int64_t mask_;
+            std::unique_ptr<std::atomic<T*>[]> items_;
+
+        public:
+            explicit RingBuffer(int64_t capacity)
+                : mask_{capacity - 1}
+                , items_{std::make_unique<std::atomic<T*>[]>(capacity)}
+            {
+            }
+
+            int64_t capacity() const
+            {
+                return mask_ + 1;
+            }
+
+            T* get(int64_t index) const
+            {
+                return items_[index & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(int64_t index, T* item)
+            {
+                items_[index & mask_].store(item, std::memory_order_relaxed);
+            }
+        };
+
+        alignas(cache_line_size) std::atomic<int64_t> top_{0};
+        alignas(cache_line_size) std::atomic<int64_t> bottom_{0};
+        alignas(cache_line_size) std::atomic<RingBuffer*> buffer_;
+        std::vector<std::unique_ptr<RingBuffer>> buffers_; // accessed only by the owner
+
+    public:
+        // capacity must be the power of 2
+        explicit WorkStealingDeque(int64_t capacity = 1024)
+        {
+            buffers_.push_back(std::make_unique<RingBuffer>(capacity));
+            buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        bool empty() const
+        {
+            return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+        }
+
+        // owner only
+        void push(T* item)
+        {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_acquire);
+            RingBuffer* buffer = buffer_.load(std::memory_order_relaxed);
+
+            if (b - t > buffer->capacity() - 1)
+                buffer = grow(buffer, b, t);
+
+            buffer->put(b, item);
+            bottom_.store(b + 1, std::memory_order_release); // publishes the item for thieves
+        }
+
+        // owner only - returns nullptr if deque is empty
+        T* pop()
+        {
+            int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            RingBuffer* buffer = buffer_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_release);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_relaxed);
+
+            if (t > b) // empty
+            {
+                bottom_.store(b + 1, std::memory_order_release);
+                return nullptr;
+            }
+
+            T* item = buffer->get(b);
+
+            if (t == b) // the last item - race with thieves
+            {
+                if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    item = nullptr;
+                bottom_.store(b + 1, std::memory_order_release);
+            }
+
+            return item;
+        }
+
+        // any thread - returns nullptr if deque is empty or the race with other thread was lost
+        T* steal()
+        {
+            int64_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom_.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return nullptr;
+
+            RingBuffer* buffer = buffer_.load(std::memory_order_acquire);
+            T* item = buffer->get(t);
+
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+
+            return item;
+        }
+
+    private:
+        RingBuffer* grow(RingBuffer* buffer, int64_t b, int64_t t)
+        {
+            auto bigger_buffer = std::make_unique<RingBuffer>(buffer->capacity() * 2);
+            for (int64_t i = t; i != b; ++i)
+                bigger_buffer->put(i, buffer->get(i));
+
+            buffers_.push_back(std::move(bigger_buffer));
+            buffer_.store(buffers_.back().get(), std::memory_order_release);
+
+            return buffers_.back().get();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,293 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include "mpmc_queue.hpp"
+#include "unique_function.hpp"
+#include "work_stealing_deque.hpp"
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Concurrency
+{
+    // Work-stealing scheduler:
+    // - every worker has its own Chase-Lev deque - tasks spawned by a worker are pushed there
+    // - tasks submitted from outside of the pool go to the shared injection queue
+    // - a worker without work steals from randomly chosen victims and parks when nothing is found
+    // - fork_join() runs nested tasks without allocations & helps with other work while waiting
+    class WorkStealingPool
+    {
+        struct Job
+        {
+            Task task;
+            bool is_detached{false};
+            bool has_external_waiter{false};
+            std::atomic<bool> is_done{false};
+            std::exception_ptr error{};
+
+            void execute()
+            {
+                if (is_detached)
+                {
+                    std::unique_ptr<Job> owned_job{this};
+
+                    try
+                    {
+                        task();
+                    }
+                    catch (...)
+                    {
+                        // nobody waits for a detached job - the exception is discarded & the worker keeps running
+                    }
+
+                    return;
+                }
+
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                is_done.store(true, std::memory_order_release); // from now on the job may be destroyed by its owner
+            }
+        };
+
+        struct alignas(cache_line_size) Worker
+        {
+            WorkStealingDeque<Job> jobs;
+            std::minstd_rand rnd;
+
+            explicit Worker(size_t seed)
+                : rnd(static_cast<unsigned>(seed + 1))
+            {
+            }
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+        BoundedMpmcQueue<Job*> injected_jobs_;
+        std::vector<std::thread> threads_;
+
+        std::atomic<bool> done_{false};
+        alignas(cache_line_size) std::atomic<unsigned> wake_up_signal_{0};
+        alignas(cache_line_size) std::atomic<size_t> sleeping_workers_{0};
+        alignas(cache_line_size) std::atomic<unsigned> completion_signal_{0};
+
+        inline static thread_local WorkStealingPool* current_pool_ = nullptr;
+        inline static thread_local size_t current_worker_ = 0;
+
+        static constexpr int spins_before_sleep = 64;
+
+    public:
+        explicit WorkStealingPool(size_t no_of_workers = std::thread::hardware_concurrency(), size_t queue_capacity = 64 * 1024)
+            : injected_jobs_{queue_capacity}
+        {
+            if (no_of_workers == 0)
+                no_of_workers = 1;
+
+            workers_.reserve(no_of_workers);
+            for (size_t i = 0; i < no_of_workers; ++i)
+                workers_.push_back(std::make_unique<Worker>(i));
+
+            threads_.reserve(no_of_workers);
+            for (size_t i = 0; i < no_of_workers; ++i)
+                threads_.emplace_back([this, i] { run(i); });
+        }
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        // all submitted tasks are executed before workers are joined
+        ~WorkStealingPool()
+        {
+            done_.store(true);
+            wake_up_signal_.fetch_add(1);
+            wake_up_signal_.notify_all();
+
+            for (auto& thd : threads_)
+                thd.join();
+        }
+
+        size_t size() const
+        {
+            return workers_.size();
+        }
+
+        // fire & forget - an exception thrown by the task is discarded (use fork_join to propagate errors)
+        template <typename TCallable>
+        void submit(TCallable&& task)
+        {
+            auto job = new Job{Task{std::forward<TCallable>(task)}, true};
+            schedule(job);
+        }
+
+        // executes both callables (potentially in parallel) & returns when both are finished
+        // exception thrown by any of them is propagated to the caller
+        template <typename F1, typename F2>
+        void fork_join(F1&& f1, F2&& f2)
+        {
+            if (current_pool_ != this) // called from outside - the whole fork_join is moved to the pool
+            {
+                Job root{Task{[this, &f1, &f2] { fork_join(f1, f2); }}, false, true};
+                schedule(&root);
+
+                while (true)
+                {
+                    unsigned signal = completion_signal_.load();
+                    if (root.is_done.load(std::memory_order_acquire))
+                        break;
+                    completion_signal_.wait(signal);
+                }
+
+                if (root.error)
+                    std::rethrow_exception(root.error);
+                return;
+            }
+
+            Job forked{Task{[&f2] { f2(); }}};
+            schedule(&forked);
+
+            try
+            {
+                f1();
+            }
+            catch (...)
+            {
+                wait_for(forked); // forked job lives on this stack frame
+                throw;
+            }
+
+            wait_for(forked);
+
+            if (forked.error)
+                std::rethrow_exception(forked.error);
+        }
+
+    private:
+        void schedule(Job* job)
+        {
+            if (current_pool_ == this)
+            {
+                workers_[current_worker_]->jobs.push(job);
+            }
+            else
+            {
+                while (!injected_jobs_.try_push(job))
+                    std::this_thread::yield();
+            }
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleeping_workers_.load(std::memory_order_relaxed) > 0)
+            {
+                wake_up_signal_.fetch_add(1, std::memory_order_release);
+                wake_up_signal_.notify_one();
+            }
+        }
+
+        Job* find_job(size_t index)
+        {
+            Worker& self = *workers_[index];
+
+            if (Job* job = self.jobs.pop())
+                return job;
+
+            if (Job* job = nullptr; injected_jobs_.try_pop(job))
+                return job;
+
+            const size_t no_of_workers = workers_.size();
+            const size_t first_victim = self.rnd() % no_of_workers;
+            for (size_t i = 0; i < no_of_workers; ++i)
+            {
+                size_t victim = (first_victim + i) % no_of_workers;
+                if (victim == index)
+                    continue;
+
+                if (Job* job = workers_[victim]->jobs.steal())
+                    return job;
+            }
+
+            return nullptr;
+        }
+
+        void execute(Job* job)
+        {
+            bool notify_waiter = job->has_external_waiter; // job must not be touched after execution
+
+            job->execute();
+
+            if (notify_waiter)
+            {
+                completion_signal_.fetch_add(1);
+                completion_signal_.notify_all();
+            }
+        }
+
+        void wait_for(Job& job)
+        {
+            while (!job.is_done.load(std::memory_order_acquire))
+            {
+                if (Job* other_job = find_job(current_worker_))
+                    execute(other_job);
+                else
+                    std::this_thread::yield();
+            }
+        }
+
+        void run(size_t index)
+        {
+            current_pool_ = this;
+            current_worker_ = index;
+
+            int spins = 0;
+
+            while (true)
+            {
+                if (Job* job = find_job(index))
+                {
+                    execute(job);
+                    spins = 0;
+                    continue;
+                }
+
+                if (done_.load())
+                    break;
+
+                if (++spins < spins_before_sleep)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                sleeping_workers_.fetch_add(1);
+                unsigned signal = wake_up_signal_.load();
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (Job* job = find_job(index))
+                {
+                    sleeping_workers_.fetch_sub(1);
+                    execute(job);
+                }
+                else
+                {
+                    if (!done_.load())
+                        wake_up_signal_.wait(signal);
+                    sleeping_workers_.fetch_sub(1);
+                }
+
+                spins = 0;
+            }
+
+            current_pool_ = nullptr;
+        }
+    };
+}
+
+#endif
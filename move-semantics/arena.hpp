@@ -0,0 +1,131 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// Monotonic arena (bump allocator) that can be reused by many batches:
+// - deallocate() is no-op - memory is reclaimed for all objects at once
+// - reset() is O(1) - chunks are kept and rewound, so after the first batch no more calls to upstream are made
+// - objects allocated in the arena must be destroyed (or abandoned if trivially destructible) before reset()
+class Arena : public std::pmr::memory_resource
+{
+    struct Chunk
+    {
+        Chunk* next;
+        size_t size;
+
+        std::byte* begin()
+        {
+            return reinterpret_cast<std::byte*>(this + 1);
+        }
+
+        std::byte* end()
+        {
+            return begin() + size;
+        }
+    };
+
+    std::pmr::memory_resource* upstream_;
+    size_t chunk_size_;
+    Chunk* first_{nullptr};
+    Chunk* current_{nullptr};
+    std::byte* position_{nullptr};
+    std::byte* end_{nullptr};
+
+public:
+    explicit Arena(size_t chunk_size = 64 * 1024, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : upstream_{upstream}
+        , chunk_size_{chunk_size}
+    {
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena()
+    {
+        while (first_)
+        {
+            Chunk* chunk = first_;
+            first_ = chunk->next;
+            upstream_->deallocate(chunk, sizeof(Chunk) + chunk->size, alignof(Chunk));
+        }
+    }
+
+    void reset() noexcept
+    {
+        current_ = first_;
+        position_ = current_ ? current_->begin() : nullptr;
+        end_ = current_ ? current_->end() : nullptr;
+    }
+
+    size_t capacity() const
+    {
+        size_t total = 0;
+        for (Chunk* chunk = first_; chunk; chunk = chunk->next)
+            total += chunk->size;
+        return total;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        while (true)
+        {
+            void* ptr = position_;
+            size_t space = end_ - position_;
+
+            if (position_ && std::align(alignment, bytes, ptr, space))
+            {
+                position_ = static_cast<std::byte*>(ptr) + bytes;
+                return ptr;
+            }
+
+            next_chunk(bytes + alignment);
+        }
+    }
+
+    void do_deallocate(void*, size_t, size_t) override
+    {
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    void next_chunk(size_t min_size)
+    {
+        if (current_ && current_->next && current_->next->size >= min_size) // reuse chunk kept after reset()
+        {
+            current_ = current_->next;
+        }
+        else
+        {
+            size_t size = std::max(chunk_size_, min_size);
+            void* memory = upstream_->allocate(sizeof(Chunk) + size, alignof(Chunk));
+            Chunk* chunk = new (memory) Chunk{nullptr, size};
+
+            if (current_)
+            {
+                chunk->next = current_->next;
+                current_->next = chunk;
+            }
+            else
+            {
+                chunk->next = first_;
+                first_ = chunk;
+            }
+
+            current_ = chunk;
+        }
+
+        position_ = current_->begin();
+        end_ = current_->end();
+    }
+};
+
+#endif
@@ -0,0 +1,203 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "arena.hpp"
+#include "pmr_data.hpp"
+#include <algorithm>
+#include <memory_resource>
+#include <vector>
+
+namespace
+{
+    class CountingResource : public std::pmr::memory_resource
+    {
+        std::pmr::memory_resource* upstream_ = std::pmr::new_delete_resource();
+
+    public:
+        size_t allocations = 0;
+        size_t deallocations = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            return upstream_->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            ++deallocations;
+            upstream_->deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE("Arena")
+{
+    CountingResource upstream;
+
+    SECTION("allocations are aligned")
+    {
+        Arena arena{1024, &upstream};
+
+        void* ptr_1 = arena.allocate(1, 1);
+        void* ptr_2 = arena.allocate(sizeof(double), alignof(double));
+        void* ptr_3 = arena.allocate(64, 64);
+
+        CHECK(ptr_1 != ptr_2);
+        CHECK(reinterpret_cast<uintptr_t>(ptr_2) % alignof(double) == 0);
+        CHECK(reinterpret_cast<uintptr_t>(ptr_3) % 64 == 0);
+        CHECK(upstream.allocations == 1);
+    }
+
+    SECTION("grows by chunks & allocates oversized blocks")
+    {
+        Arena arena{256, &upstream};
+
+        for (int i = 0; i < 10; ++i)
+            CHECK(arena.allocate(100, 8) != nullptr);
+        CHECK(arena.allocate(10'000, 8) != nullptr);
+
+        CHECK(upstream.allocations > 1);
+        CHECK(arena.capacity() >= 10 * 100 + 10'000);
+    }
+
+    SECTION("reset rewinds - chunks are reused")
+    {
+        Arena arena{256, &upstream};
+
+        void* first = arena.allocate(100, 8);
+        for (int i = 0; i < 10; ++i)
+            CHECK(arena.allocate(100, 8) != nullptr);
+
+        size_t allocations_after_first_batch = upstream.allocations;
+
+        arena.reset();
+
+        CHECK(arena.allocate(100, 8) == first);
+        for (int i = 0; i < 10; ++i)
+            CHECK(arena.allocate(100, 8) != nullptr);
+
+        CHECK(upstream.allocations == allocations_after_first_batch);
+    }
+
+    SECTION("memory is returned to upstream when arena is destroyed")
+    {
+        {
+            Arena arena{256, &upstream};
+            CHECK(arena.allocate(1000, 8) != nullptr);
+            CHECK(arena.allocate(1000, 8) != nullptr);
+        }
+
+        CHECK(upstream.allocations == upstream.deallocations);
+    }
+}
+
+TEST_CASE("Pmr::Data")
+{
+    using Pmr::Data;
+
+    Arena arena;
+
+    SECTION("construction in arena")
+    {
+        Data ds{"ds", {1, 2, 3}, &arena};
+
+        CHECK(ds.get_allocator().resource() == &arena);
+        CHECK(std::equal(ds.begin(), ds.end(), std::begin({1, 2, 3})));
+        CHECK(ds.name() == "ds");
+    }
+
+    SECTION("copy uses default resource")
+    {
+        Data ds{"ds", {1, 2, 3}, &arena};
+        Data backup = ds;
+
+        CHECK(backup.get_allocator().resource() == std::pmr::get_default_resource());
+        CHECK(std::equal(backup.begin(), backup.end(), ds.begin(), ds.end()));
+    }
+
+    SECTION("move steals the buffer")
+    {
+        Data ds{"ds", {1, 2, 3}, &arena};
+        const int* buffer = ds.begin();
+
+        Data target = std::move(ds);
+
+        CHECK(target.begin() == buffer);
+        CHECK(target.get_allocator().resource() == &arena);
+        CHECK(ds.size() == 0);
+    }
+
+    SECTION("move to other resource copies items")
+    {
+        Data ds{"ds", {1, 2, 3}, &arena};
+        const int* buffer = ds.begin();
+
+        Data target{std::move(ds), std::pmr::get_default_resource()};
+
+        CHECK(target.begin() != buffer);
+        CHECK(target.size() == 3);
+    }
+
+    SECTION("pmr containers pass the arena to items")
+    {
+        std::pmr::vector<Data> data_sets{&arena};
+        data_sets.emplace_back("ds1", std::initializer_list<int>{1, 2, 3});
+        data_sets.push_back(Pmr::create_data_set());
+
+        CHECK(data_sets[0].get_allocator().resource() == &arena);
+        CHECK(data_sets[1].get_allocator().resource() == &arena);
+        CHECK(data_sets[1].size() == 7);
+    }
+}
+
+TEST_CASE("Data sets - heap vs. arena", "[.][benchmark]")
+{
+    constexpr size_t batch_size = 10'000;
+
+    BENCHMARK("heap - std::vector<Pmr::Data>")
+    {
+        std::vector<Pmr::Data> batch;
+        batch.reserve(batch_size);
+        for (size_t i = 0; i < batch_size; ++i)
+            batch.push_back(Pmr::create_data_set());
+        return batch.size();
+    };
+
+    Arena arena{1024 * 1024};
+
+    BENCHMARK("arena - std::pmr::vector<Pmr::Data> + reset()")
+    {
+        size_t size = 0;
+        {
+            std::pmr::vector<Pmr::Data> batch{&arena};
+            batch.reserve(batch_size);
+            for (size_t i = 0; i < batch_size; ++i)
+                batch.push_back(Pmr::create_data_set(&arena));
+            size = batch.size();
+        }
+        arena.reset();
+        return size;
+    };
+
+    std::pmr::monotonic_buffer_resource monotonic;
+
+    BENCHMARK("std::pmr::monotonic_buffer_resource + release()")
+    {
+        size_t size = 0;
+        {
+            std::pmr::vector<Pmr::Data> batch{&monotonic};
+            batch.reserve(batch_size);
+            for (size_t i = 0; i < batch_size; ++i)
+                batch.push_back(Pmr::create_data_set(&monotonic));
+            size = batch.size();
+        }
+        monotonic.release();
+        return size;
+    };
+}
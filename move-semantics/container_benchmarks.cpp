@@ -0,0 +1,163 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "gadget.hpp"
+#include "gadget_container.hpp"
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const std::string gadget_name = "gadget-with-a-name-longer-than-sso-buffer";
+
+    constexpr size_t no_of_gadgets = 1'000;
+
+    template <typename TGadget>
+    struct PushBack
+    {
+        static constexpr const char* name = "vector::push_back(TGadget{})";
+
+        std::vector<TGadget> gadgets;
+
+        explicit PushBack(size_t capacity)
+        {
+            gadgets.reserve(capacity);
+        }
+
+        void insert(int id)
+        {
+            gadgets.push_back(TGadget{id, gadget_name});
+        }
+    };
+
+    template <typename TGadget>
+    struct EmplaceBack
+    {
+        static constexpr const char* name = "vector::emplace_back(args...)";
+
+        std::vector<TGadget> gadgets;
+
+        explicit EmplaceBack(size_t capacity)
+        {
+            gadgets.reserve(capacity);
+        }
+
+        void insert(int id)
+        {
+            gadgets.emplace_back(id, gadget_name);
+        }
+    };
+
+    template <typename TGadget>
+    struct ContainerAdd
+    {
+        static constexpr const char* name = "GadgetContainer::add(TGadget{})";
+
+        BasicGadgetContainer<TGadget> container;
+
+        explicit ContainerAdd(size_t capacity)
+            : container{capacity}
+        {
+        }
+
+        void insert(int id)
+        {
+            container.add(TGadget{id, gadget_name});
+        }
+    };
+
+    template <typename TGadget>
+    struct ContainerEmplace
+    {
+        static constexpr const char* name = "GadgetContainer::emplace(args...)";
+
+        BasicGadgetContainer<TGadget> container;
+
+        explicit ContainerEmplace(size_t capacity)
+            : container{capacity}
+        {
+        }
+
+        void insert(int id)
+        {
+            container.emplace(id, gadget_name);
+        }
+    };
+
+    template <typename TScenario>
+    void fill(size_t capacity)
+    {
+        TScenario scenario{capacity};
+        for (size_t i = 0; i < no_of_gadgets; ++i)
+            scenario.insert(static_cast<int>(i));
+    }
+
+    template <template <typename> class TScenario, typename TGadget>
+    void run_scenario(const std::string& gadget_kind)
+    {
+        for (bool with_reserve : {false, true})
+        {
+            const size_t capacity = with_reserve ? no_of_gadgets : 0;
+            const std::string label = std::string{TScenario<TGadget>::name} + " - " + gadget_kind
+                + (with_reserve ? " - reserved" : " - no reserve");
+
+            TGadget::reset_counters();
+            fill<TScenario<TGadget>>(capacity);
+
+            std::cout << std::left << std::setw(90) << label
+                      << " copies/op: " << std::setw(6) << static_cast<double>(TGadget::copy_counter) / no_of_gadgets
+                      << " moves/op: " << static_cast<double>(TGadget::move_counter) / no_of_gadgets << "\n";
+
+            BENCHMARK(label + " [" + std::to_string(no_of_gadgets) + " ops]")
+            {
+                return fill<TScenario<TGadget>>(capacity);
+            };
+        }
+    }
+
+    template <typename TGadget>
+    void run_all_scenarios(const std::string& gadget_kind)
+    {
+        run_scenario<PushBack, TGadget>(gadget_kind);
+        run_scenario<EmplaceBack, TGadget>(gadget_kind);
+        run_scenario<ContainerAdd, TGadget>(gadget_kind);
+        run_scenario<ContainerEmplace, TGadget>(gadget_kind);
+    }
+}
+
+TEST_CASE("Gadget as a probe - reallocation copies vs. moves")
+{
+    SECTION("noexcept move - vector moves items on reallocation")
+    {
+        CountingGadget::reset_counters();
+        fill<EmplaceBack<CountingGadget>>(0);
+
+        CHECK(CountingGadget::copy_counter == 0);
+        CHECK(CountingGadget::move_counter > 0);
+    }
+
+    SECTION("throwing move - vector copies items on reallocation")
+    {
+        ThrowingMoveGadget::reset_counters();
+        fill<EmplaceBack<ThrowingMoveGadget>>(0);
+
+        CHECK(ThrowingMoveGadget::copy_counter > 0);
+        CHECK(ThrowingMoveGadget::move_counter == 0);
+    }
+
+    SECTION("reserve - no reallocation")
+    {
+        ThrowingMoveGadget::reset_counters();
+        fill<EmplaceBack<ThrowingMoveGadget>>(no_of_gadgets);
+
+        CHECK(ThrowingMoveGadget::copy_counter == 0);
+        CHECK(ThrowingMoveGadget::move_counter == 0);
+    }
+}
+
+TEST_CASE("container move/copy cost", "[.][benchmark]")
+{
+    run_all_scenarios<CountingGadget>("noexcept move");
+    run_all_scenarios<ThrowingMoveGadget>("throwing move");
+}
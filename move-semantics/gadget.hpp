@@ -1,13 +1,39 @@
 #ifndef GADGET_HPP
 #define GADGET_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <type_traits>
 
-struct Gadget
+namespace GadgetTracing
 {
-    inline static uintmax_t copy_counter = 0;
-    inline static uintmax_t move_counter = 0;
+    struct Silent    // no counting & no output - zero overhead probe
+    {
+    };
+
+    struct Counting  // thread-safe copy/move counters, no output
+    {
+    };
+
+    struct Verbose   // counters + every constructor, assignment & destructor is traced to std::cout
+    {
+    };
+
+    template <typename TTracing>
+    constexpr bool is_counting_v = std::is_same_v<TTracing, Counting> || std::is_same_v<TTracing, Verbose>;
+
+    template <typename TTracing>
+    constexpr bool is_verbose_v = std::is_same_v<TTracing, Verbose>;
+}
+
+// NoexceptMove = false makes move operations potentially throwing (std::vector copies such gadgets on reallocation)
+template <typename TTracing = GadgetTracing::Verbose, bool NoexceptMove = true>
+struct BasicGadget
+{
+    alignas(64) inline static std::atomic<uintmax_t> copy_counter{0};
+    alignas(64) inline static std::atomic<uintmax_t> move_counter{0};
 
     static void reset_counters()
     {
@@ -27,26 +53,26 @@ struct Gadget
     std::string name{"default-name"};
     bool is_after_move{false};
 
-    Gadget()
+    BasicGadget()
     {
-        std::cout << "Gadget(dc: " << id << ", " << name << ")\n";
+        trace("Gadget(dc: ", id, ", ", name, ")\n");
     }
 
-    Gadget(int v, const std::string& n)
+    BasicGadget(int v, const std::string& n)
         : id{v}
         , name{n}
     {
-        std::cout << "Gadget(" << id << ", " << name << ")\n";
+        trace("Gadget(", id, ", ", name, ")\n");
     }
 
-    Gadget(const Gadget& other)
+    BasicGadget(const BasicGadget& other)
         : id{other.id}, name{other.name}, is_after_move{other.is_after_move}
     {
-        std::cout << "Gadget(cc: " << id << ", " << name << ")\n";
-        ++copy_counter;
+        trace("Gadget(cc: ", id, ", ", name, ")\n");
+        count(copy_counter);
     }
 
-    Gadget& operator=(const Gadget& other)
+    BasicGadget& operator=(const BasicGadget& other)
     {
         if (this != &other)
         {
@@ -55,21 +81,21 @@ struct Gadget
             is_after_move = other.is_after_move;
         }
 
-        std::cout << "Gadget(copy_assignment: " << id << ", " << name << ")\n";
-        ++copy_counter;
+        trace("Gadget(copy_assignment: ", id, ", ", name, ")\n");
+        count(copy_counter);
 
         return *this;
     }
 
-    Gadget(Gadget&& other) noexcept
+    BasicGadget(BasicGadget&& other) noexcept(NoexceptMove)
         : id{std::move(other.id)}, name{std::move(other.name)}
     {
         other.is_after_move = true;
-        std::cout << "Gadget(mv: " << id << ", " << name << ")\n";
-        ++move_counter;
+        trace("Gadget(mv: ", id, ", ", name, ")\n");
+        count(move_counter);
     }
 
-    Gadget& operator=(Gadget&& other) 
+    BasicGadget& operator=(BasicGadget&& other)
     {
         if (this != &other)
         {
@@ -80,21 +106,21 @@ struct Gadget
             other.is_after_move = true;
         }
 
-        std::cout << "Gadget(move_assignment: " << id << ", " << name << ")\n";
-        ++move_counter;
+        trace("Gadget(move_assignment: ", id, ", ", name, ")\n");
+        count(move_counter);
 
         return *this;
     }
 
-    ~Gadget()
+    ~BasicGadget()
     {
         if (!is_after_move)
         {
-            std::cout << "~Gadget(" << id << ", " << name << ")\n";
+            trace("~Gadget(", id, ", ", name, ")\n");
         }
         else
         {
-            std::cout << "~Gadget(" << id << " - after move)\n";
+            trace("~Gadget(", id, " - after move)\n");
         }
     }
 
@@ -102,6 +128,25 @@ struct Gadget
     {
         std::cout << "Using Gadget(" << id << ", " << name << ")\n";
     }
+
+private:
+    template <typename... TArgs>
+    static void trace([[maybe_unused]] const TArgs&... args)
+    {
+        if constexpr (GadgetTracing::is_verbose_v<TTracing>)
+            (std::cout << ... << args);
+    }
+
+    static void count([[maybe_unused]] std::atomic<uintmax_t>& counter)
+    {
+        if constexpr (GadgetTracing::is_counting_v<TTracing>)
+            counter.fetch_add(1, std::memory_order_relaxed);
+    }
 };
 
-#endif
\ No newline at end of file
+using Gadget = BasicGadget<GadgetTracing::Verbose>;
+using SilentGadget = BasicGadget<GadgetTracing::Silent>;
+using CountingGadget = BasicGadget<GadgetTracing::Counting>;
+using ThrowingMoveGadget = BasicGadget<GadgetTracing::Counting, false>;
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef GADGET_CONTAINER_HPP
+#define GADGET_CONTAINER_HPP
+
+#include "gadget.hpp"
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+template <typename TGadget = Gadget>
+struct BasicGadgetContainer
+{
+    std::vector<TGadget> gadgets;
+
+    explicit BasicGadgetContainer(size_t capacity = 100)
+    {
+        gadgets.reserve(capacity);
+    }
+
+    /*
+    void add(const TGadget& g)
+    {
+        gadgets.push_back(g);
+    }
+
+    void add(TGadget&& g)
+    {
+        gadgets.push_back(std::move(g));
+    }
+   */
+
+    template<typename T>
+    void add(T&& g)
+    {
+        gadgets.push_back(std::forward<T>(g));
+    }
+
+    template <typename... TArgs>
+    void emplace(TArgs&&... args)
+    {
+        gadgets.emplace_back(std::forward<TArgs>(args)...);
+    }
+};
+
+using GadgetContainer = BasicGadgetContainer<>;
+
+#endif
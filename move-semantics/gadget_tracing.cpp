@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+#include "gadget.hpp"
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE("Gadget tracing policies")
+{
+    SECTION("Gadget is verbose by default")
+    {
+        static_assert(std::is_same_v<Gadget, BasicGadget<>>);
+        static_assert(GadgetTracing::is_verbose_v<GadgetTracing::Verbose>);
+        static_assert(GadgetTracing::is_counting_v<GadgetTracing::Verbose>);
+    }
+
+    SECTION("Silent - counters are not touched")
+    {
+        SilentGadget::reset_counters();
+
+        SilentGadget g{1, "ipad"};
+        SilentGadget copy = g;
+        SilentGadget target = std::move(copy);
+
+        CHECK(SilentGadget::copy_counter == 0);
+        CHECK(SilentGadget::move_counter == 0);
+    }
+
+    SECTION("Counting - copies & moves are counted")
+    {
+        CountingGadget::reset_counters();
+
+        CountingGadget g{1, "ipad"};
+        CountingGadget copy = g;
+        CountingGadget target = std::move(copy);
+        target = g;
+        target = std::move(copy);
+
+        CHECK(CountingGadget::copy_counter == 2);
+        CHECK(CountingGadget::move_counter == 2);
+    }
+
+    SECTION("Counting - counters are thread-safe")
+    {
+        CountingGadget::reset_counters();
+
+        constexpr int no_of_threads = 4;
+        constexpr int no_of_copies = 10'000;
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < no_of_threads; ++i)
+            threads.emplace_back([] {
+                CountingGadget g{1, "ipad"};
+                for (int j = 0; j < no_of_copies; ++j)
+                {
+                    CountingGadget copy = g;
+                    CountingGadget target = std::move(copy);
+                }
+            });
+
+        for (auto& thd : threads)
+            thd.join();
+
+        CHECK(CountingGadget::copy_counter == no_of_threads * no_of_copies);
+        CHECK(CountingGadget::move_counter == no_of_threads * no_of_copies);
+    }
+}
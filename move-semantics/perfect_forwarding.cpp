@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include "gadget.hpp"
+#include "gadget_container.hpp"
 #include <atomic>
 
 //#define MSVC
@@ -82,40 +83,6 @@ TEST_CASE("custom forwarding")
 
 ///////////////////////////////////////////////////////////////////////////
 
-struct GadgetContainer
-{
-    std::vector<Gadget> gadgets;
-
-    GadgetContainer()
-    {
-        gadgets.reserve(100);
-    }
-
-    /*
-    void add(const Gadget& g)
-    {
-        gadgets.push_back(g);
-    }
-
-    void add(Gadget&& g)
-    {
-        gadgets.push_back(std::move(g));
-    }
-   */
-
-    template<typename T>
-    void add(T&& g)
-    {
-        gadgets.push_back(std::forward<T>(g));
-    }
-
-    template <typename... TArgs>
-    void emplace(TArgs&&... args)
-    {
-        gadgets.emplace_back(std::forward<TArgs>(args)...);
-    }
-};
-
 TEST_CASE("forwarding to containers")
 {
     Gadget::reset_counters();
@@ -0,0 +1,159 @@
+#ifndef PMR_DATA_HPP
+#define PMR_DATA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace Pmr
+{
+    ////////////////////////////////////////////////////////////////////////////
+    // Data - allocator-aware version of Data class (without tracing to std::cout)
+    //  - memory for name & items comes from std::pmr::memory_resource (e.g. Arena)
+    //  - allocator is not propagated on copy (the same rule as for std::pmr containers)
+    //  - move steals the buffer only when both objects use the same memory resource
+
+    class Data
+    {
+    public:
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+        using iterator = int*;
+        using const_iterator = const int*;
+
+    private:
+        allocator_type allocator_;
+        std::pmr::string name_;
+        int* data_;
+        size_t size_;
+
+    public:
+        Data(std::string_view name, std::initializer_list<int> list, allocator_type allocator = {})
+            : allocator_{allocator}
+            , name_{name, allocator}
+            , data_{allocator_.allocate_object<int>(list.size())}
+            , size_{list.size()}
+        {
+            std::copy(list.begin(), list.end(), data_);
+        }
+
+        Data(const Data& other, allocator_type allocator = {})
+            : allocator_{allocator}
+            , name_{other.name_, allocator}
+            , data_{allocator_.allocate_object<int>(other.size_)}
+            , size_{other.size_}
+        {
+            std::copy(other.begin(), other.end(), data_);
+        }
+
+        Data(Data&& other) noexcept
+            : allocator_{other.allocator_}
+            , name_{std::move(other.name_)}
+            , data_{std::exchange(other.data_, nullptr)}
+            , size_{std::exchange(other.size_, 0)}
+        {
+        }
+
+        Data(Data&& other, allocator_type allocator)
+            : allocator_{allocator}
+            , name_{std::move(other.name_), allocator}
+            , data_{nullptr}
+            , size_{0}
+        {
+            if (allocator_ == other.allocator_)
+            {
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            else
+            {
+                data_ = allocator_.allocate_object<int>(other.size_);
+                size_ = other.size_;
+                std::copy(other.begin(), other.end(), data_);
+            }
+        }
+
+        Data& operator=(const Data& other)
+        {
+            if (this != &other)
+            {
+                Data temp(other, allocator_); // cc in the same memory resource
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        Data& operator=(Data&& other)
+        {
+            if (this != &other)
+            {
+                Data temp(std::move(other), allocator_); // mv (or copy if resources differ)
+                swap(temp);
+            }
+
+            return *this;
+        }
+
+        ~Data()
+        {
+            if (data_)
+                allocator_.deallocate_object(data_, size_);
+        }
+
+        // both objects must use the same memory resource
+        void swap(Data& other) noexcept
+        {
+            name_.swap(other.name_);
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+        }
+
+        allocator_type get_allocator() const
+        {
+            return allocator_;
+        }
+
+        std::string_view name() const
+        {
+            return name_;
+        }
+
+        iterator begin()
+        {
+            return data_;
+        }
+
+        iterator end()
+        {
+            return data_ + size_;
+        }
+
+        const_iterator begin() const
+        {
+            return data_;
+        }
+
+        const_iterator end() const
+        {
+            return data_ + size_;
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+    };
+
+    inline Data create_data_set(Data::allocator_type allocator = {})
+    {
+        Data ds{"data-set-one", {54, 6, 34, 235, 64356, 235, 23}, allocator};
+
+        return ds;
+    }
+}
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef COMPACT_OPTIONAL_HPP
+#define COMPACT_OPTIONAL_HPP
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace ModernCpp
+{
+    // Optional that marks "no value" with a reserved value of T (e.g. INT_MIN, -1 for indexes, nullptr)
+    // - sizeof(compact_optional<T, Sentinel>) == sizeof(T) - no bool & no padding
+    // - the same API as std::optional (has_value, value, value_or, *, reset, comparisons)
+    // - storing the Sentinel itself gives empty optional
+    template <typename T, T Sentinel>
+    class compact_optional
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "compact_optional is meant for trivially copyable types");
+
+        T value_{Sentinel};
+
+    public:
+        using value_type = T;
+        static constexpr T sentinel = Sentinel;
+
+        constexpr compact_optional() noexcept = default;
+
+        constexpr compact_optional(std::nullopt_t) noexcept
+        {
+        }
+
+        constexpr compact_optional(T value) noexcept
+            : value_{value}
+        {
+        }
+
+        constexpr compact_optional(const std::optional<T>& opt) noexcept
+            : value_{opt.value_or(Sentinel)}
+        {
+        }
+
+        constexpr compact_optional& operator=(std::nullopt_t) noexcept
+        {
+            value_ = Sentinel;
+            return *this;
+        }
+
+        constexpr bool has_value() const noexcept
+        {
+            return value_ != Sentinel;
+        }
+
+        constexpr explicit operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        constexpr const T& operator*() const noexcept
+        {
+            return value_;
+        }
+
+        constexpr const T* operator->() const noexcept
+        {
+            return &value_;
+        }
+
+        constexpr const T& value() const
+        {
+            if (!has_value())
+                throw std::bad_optional_access{};
+            return value_;
+        }
+
+        constexpr T value_or(T default_value) const noexcept
+        {
+            return has_value() ? value_ : default_value;
+        }
+
+        constexpr void reset() noexcept
+        {
+            value_ = Sentinel;
+        }
+
+        constexpr T& emplace(T value) noexcept
+        {
+            value_ = value;
+            return value_;
+        }
+
+        constexpr void swap(compact_optional& other) noexcept
+        {
+            std::swap(value_, other.value_);
+        }
+
+        constexpr operator std::optional<T>() const
+        {
+            return has_value() ? std::optional<T>{value_} : std::nullopt;
+        }
+
+        // the same semantics as std::optional: empty == empty; empty < any value
+        friend constexpr bool operator==(const compact_optional& lhs, const compact_optional& rhs) noexcept = default;
+
+        friend constexpr std::compare_three_way_result_t<T> operator<=>(const compact_optional& lhs, const compact_optional& rhs) noexcept
+            requires std::three_way_comparable<T>
+        {
+            if (lhs.has_value() && rhs.has_value())
+                return lhs.value_ <=> rhs.value_;
+            return lhs.has_value() <=> rhs.has_value();
+        }
+
+        friend constexpr bool operator==(const compact_optional& lhs, const T& rhs) noexcept
+        {
+            return lhs.has_value() && lhs.value_ == rhs;
+        }
+
+        friend constexpr auto operator<=>(const compact_optional& lhs, const T& rhs) noexcept
+            requires std::three_way_comparable<T>
+        {
+            return lhs.has_value() ? lhs.value_ <=> rhs : std::compare_three_way_result_t<T>(std::strong_ordering::less);
+        }
+
+        friend constexpr bool operator==(const compact_optional& lhs, std::nullopt_t) noexcept
+        {
+            return !lhs.has_value();
+        }
+
+        friend constexpr std::strong_ordering operator<=>(const compact_optional& lhs, std::nullopt_t) noexcept
+        {
+            return lhs.has_value() <=> false;
+        }
+    };
+}
+
+template <typename T, T Sentinel>
+struct std::hash<ModernCpp::compact_optional<T, Sentinel>>
+{
+    size_t operator()(const ModernCpp::compact_optional<T, Sentinel>& opt) const noexcept
+    {
+        return std::hash<T>{}(*opt);
+    }
+};
+
+#endif
@@ -0,0 +1,269 @@
+#ifndef OPTIONAL_VECTOR_HPP
+#define OPTIONAL_VECTOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace ModernCpp
+{
+    // Column of nullable numbers - the same content as std::vector<std::optional<T>>, but:
+    // - values are stored densely (sizeof(T) per item instead of 2 * sizeof(T) for ints)
+    // - validity is kept in a separate bitmap (1 bit per item; 1 - value, 0 - null)
+    // - null items hold T{}, so sum() is a plain (vectorized) loop over values
+    // - min()/max() skip 64 nulls at once; in other words nulls are patched with the neutral element
+    //   & the block is reduced by a branch-free (vectorized) loop
+    template <typename T>
+    class optional_vector
+    {
+        static_assert(std::is_arithmetic_v<T>, "optional_vector is a column of numbers");
+
+        std::vector<T> values_;
+        std::vector<uint64_t> validity_;
+        size_t size_{0};
+
+        static constexpr size_t bits_per_word = 64;
+
+    public:
+        using value_type = std::optional<T>;
+        using sum_type = std::conditional_t<std::is_integral_v<T>, std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>, double>;
+
+        // optional-like access to the item
+        class reference
+        {
+            optional_vector* owner_;
+            size_t index_;
+
+        public:
+            reference(optional_vector* owner, size_t index)
+                : owner_{owner}
+                , index_{index}
+            {
+            }
+
+            bool has_value() const
+            {
+                return owner_->has_value(index_);
+            }
+
+            explicit operator bool() const
+            {
+                return has_value();
+            }
+
+            T& operator*() const
+            {
+                assert(has_value());
+                return owner_->values_[index_];
+            }
+
+            T& value() const
+            {
+                if (!has_value())
+                    throw std::bad_optional_access{};
+                return owner_->values_[index_];
+            }
+
+            T value_or(T default_value) const
+            {
+                return has_value() ? owner_->values_[index_] : default_value;
+            }
+
+            operator std::optional<T>() const
+            {
+                return owner_->get(index_);
+            }
+
+            reference& operator=(const std::optional<T>& item)
+            {
+                owner_->set(index_, item);
+                return *this;
+            }
+
+            reference& operator=(const reference& other)
+            {
+                owner_->set(index_, other.owner_->get(other.index_));
+                return *this;
+            }
+
+            void reset()
+            {
+                owner_->set(index_, std::nullopt);
+            }
+
+            friend bool operator==(const reference& item, const std::optional<T>& other)
+            {
+                return item.owner_->get(item.index_) == other;
+            }
+        };
+
+        optional_vector() = default;
+
+        // all items are nulls
+        explicit optional_vector(size_t size)
+            : values_(size)
+            , validity_(word_count(size))
+            , size_{size}
+        {
+        }
+
+        optional_vector(std::initializer_list<std::optional<T>> items)
+        {
+            reserve(items.size());
+            for (const auto& item : items)
+                push_back(item);
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        void reserve(size_t capacity)
+        {
+            values_.reserve(capacity);
+            validity_.reserve(word_count(capacity));
+        }
+
+        // memory used by items & bitmap
+        size_t memory_footprint() const
+        {
+            return values_.capacity() * sizeof(T) + validity_.capacity() * sizeof(uint64_t);
+        }
+
+        void push_back(const std::optional<T>& item)
+        {
+            if (size_ % bits_per_word == 0)
+                validity_.push_back(0);
+
+            values_.push_back(item.value_or(T{}));
+            validity_.back() |= uint64_t{item.has_value()} << (size_ % bits_per_word);
+            ++size_;
+        }
+
+        bool has_value(size_t index) const
+        {
+            assert(index < size_);
+            return (validity_[index / bits_per_word] >> (index % bits_per_word)) & 1;
+        }
+
+        std::optional<T> get(size_t index) const
+        {
+            return has_value(index) ? std::optional{values_[index]} : std::nullopt;
+        }
+
+        void set(size_t index, const std::optional<T>& item)
+        {
+            assert(index < size_);
+
+            uint64_t bit = uint64_t{1} << (index % bits_per_word);
+            values_[index] = item.value_or(T{});
+
+            if (item)
+                validity_[index / bits_per_word] |= bit;
+            else
+                validity_[index / bits_per_word] &= ~bit;
+        }
+
+        std::optional<T> operator[](size_t index) const
+        {
+            return get(index);
+        }
+
+        reference operator[](size_t index)
+        {
+            return reference{this, index};
+        }
+
+        size_t null_count() const
+        {
+            size_t valid_count = 0;
+            for (uint64_t word : validity_)
+                valid_count += std::popcount(word);
+            return size_ - valid_count;
+        }
+
+        // sum of non-null items (0 for empty or all-null column)
+        sum_type sum() const
+        {
+            sum_type total{};
+            for (T value : values_) // nulls hold T{}
+                total += value;
+            return total;
+        }
+
+        // nullopt if all items are nulls
+        std::optional<T> min() const
+        {
+            return reduce([](T a, T b) { return b < a ? b : a; },
+                std::is_floating_point_v<T> ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max());
+        }
+
+        std::optional<T> max() const
+        {
+            return reduce([](T a, T b) { return a < b ? b : a; },
+                std::is_floating_point_v<T> ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest());
+        }
+
+    private:
+        static size_t word_count(size_t size)
+        {
+            return (size + bits_per_word - 1) / bits_per_word;
+        }
+
+        // identity is the neutral element of the operation (it is also used in place of nulls)
+        template <typename TOperation>
+        std::optional<T> reduce(TOperation op, T identity) const
+        {
+            T result = identity;
+            bool has_any_value = false;
+
+            for (size_t w = 0; w < validity_.size(); ++w)
+            {
+                uint64_t word = validity_[w];
+                if (word == 0)
+                    continue;
+
+                has_any_value = true;
+
+                const T* values = values_.data() + w * bits_per_word;
+                size_t count = std::min(bits_per_word, size_ - w * bits_per_word);
+
+                if (std::popcount(word) < static_cast<int>(count / 2)) // mostly nulls - visit only the values
+                {
+                    for (; word != 0; word &= word - 1)
+                        result = op(result, values[std::countr_zero(word)]);
+                    continue;
+                }
+
+                T block[bits_per_word];
+                std::copy_n(values, count, block);
+
+                for (uint64_t nulls = ~word & (count == bits_per_word ? ~uint64_t{0} : (uint64_t{1} << count) - 1); nulls != 0; nulls &= nulls - 1)
+                    block[std::countr_zero(nulls)] = identity; // patch nulls with the neutral element
+
+                T acc = identity;
+                for (size_t i = 0; i < count; ++i) // branch-free loop without the mask - vectorized
+                    acc = op(acc, block[i]);
+
+                result = op(result, acc);
+            }
+
+            return has_any_value ? std::optional{result} : std::nullopt;
+        }
+    };
+}
+
+#endif
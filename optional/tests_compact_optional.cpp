@@ -0,0 +1,255 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "compact_optional.hpp"
+#include <bit>
+#include <climits>
+#include <cstdint>
+#include <compare>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+using ModernCpp::compact_optional;
+
+namespace
+{
+    using OptionalInt = compact_optional<int, INT_MIN>;
+    using OptionalIndex = compact_optional<size_t, SIZE_MAX>;
+
+    int value = 42;
+    using OptionalPtr = compact_optional<const int*, nullptr>;
+}
+
+TEST_CASE("compact_optional")
+{
+    static_assert(sizeof(OptionalInt) == sizeof(int));
+    static_assert(sizeof(OptionalIndex) == sizeof(size_t));
+    static_assert(sizeof(OptionalPtr) == sizeof(void*));
+
+    SECTION("default constructed is empty")
+    {
+        OptionalInt opt_int;
+
+        CHECK(opt_int.has_value() == false);
+        CHECK_FALSE(opt_int);
+        CHECK(opt_int == std::nullopt);
+        CHECK(opt_int.value_or(-1) == -1);
+        CHECK_THROWS_AS(opt_int.value(), std::bad_optional_access);
+    }
+
+    SECTION("holding value")
+    {
+        OptionalInt opt_number = 42;
+
+        CHECK(opt_number.has_value());
+        CHECK(*opt_number == 42);
+        CHECK(opt_number.value() == 42);
+        CHECK(opt_number == 42);
+        CHECK(opt_number != 41);
+        CHECK(opt_number != std::nullopt);
+
+        opt_number.reset();
+        CHECK(opt_number == std::nullopt);
+
+        opt_number.emplace(7);
+        CHECK(opt_number == 7);
+
+        opt_number = std::nullopt;
+        CHECK_FALSE(opt_number.has_value());
+    }
+
+    SECTION("sentinel means no value")
+    {
+        OptionalInt opt_int = INT_MIN;
+
+        CHECK_FALSE(opt_int.has_value());
+    }
+
+    SECTION("ordering is the same as for std::optional")
+    {
+        OptionalInt empty;
+        OptionalInt one = 1;
+        OptionalInt two = 2;
+
+        CHECK(empty < one);
+        CHECK(one < two);
+        CHECK(empty == OptionalInt{});
+        CHECK(one < 2);
+        CHECK(empty < -1'000);
+        CHECK(one > std::nullopt);
+
+        CHECK((std::optional<int>{} < std::optional{1}) == (empty < one));
+    }
+
+    SECTION("ordering of floating point values is partial")
+    {
+        using OptionalDouble = compact_optional<double, -1.0>;
+
+        OptionalDouble empty;
+        OptionalDouble half = 0.5;
+        OptionalDouble nan = std::numeric_limits<double>::quiet_NaN();
+
+        static_assert(std::is_same_v<decltype(half <=> empty), std::partial_ordering>);
+        CHECK(empty < half);
+        CHECK(half > OptionalDouble{0.25});
+        CHECK(half == OptionalDouble{0.5});
+        CHECK((half <=> nan) == std::partial_ordering::unordered);
+        CHECK(empty < nan);
+    }
+
+    SECTION("conversions from & to std::optional")
+    {
+        OptionalInt opt_int = std::optional{5};
+        std::optional<int> std_opt = opt_int;
+
+        CHECK(std_opt == 5);
+        CHECK(std::optional<int>(OptionalInt{}) == std::nullopt);
+    }
+
+    SECTION("pointers & indexes")
+    {
+        OptionalPtr opt_ptr;
+        CHECK_FALSE(opt_ptr);
+
+        opt_ptr = &value;
+        CHECK(**opt_ptr == 42);
+
+        OptionalIndex opt_index = std::vector{1, 2, 3}.size();
+        CHECK(opt_index == 3u);
+    }
+
+    SECTION("constexpr")
+    {
+        constexpr OptionalInt opt_int = 3;
+        static_assert(opt_int.value_or(0) == 3);
+        static_assert(!OptionalInt{}.has_value());
+    }
+}
+
+namespace
+{
+    // open-addressing hash set of ints with linear probing - empty slots are TSlot{}
+    template <typename TSlot>
+    class FlatIntSet
+    {
+        std::vector<TSlot> slots_;
+        size_t mask_;
+
+    public:
+        explicit FlatIntSet(size_t expected_size)
+            : slots_(std::bit_ceil(expected_size * 2))
+            , mask_{slots_.size() - 1}
+        {
+        }
+
+        void insert(int key)
+        {
+            for (size_t i = hash(key);; i = (i + 1) & mask_)
+            {
+                if (!slots_[i].has_value())
+                {
+                    slots_[i] = key;
+                    return;
+                }
+
+                if (*slots_[i] == key)
+                    return;
+            }
+        }
+
+        bool contains(int key) const
+        {
+            for (size_t i = hash(key);; i = (i + 1) & mask_)
+            {
+                if (!slots_[i].has_value())
+                    return false;
+
+                if (*slots_[i] == key)
+                    return true;
+            }
+        }
+
+        size_t memory_footprint() const
+        {
+            return slots_.size() * sizeof(TSlot);
+        }
+
+    private:
+        size_t hash(int key) const
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(key)) * 0x9E3779B97F4A7C15ULL >> 32) & mask_;
+        }
+    };
+}
+
+TEST_CASE("compact_optional in containers", "[.][benchmark]")
+{
+    constexpr size_t no_of_items = 4'000'000;
+
+    std::mt19937 rnd{665};
+    std::uniform_int_distribution<int> key_distr{0, INT_MAX};
+
+    std::vector<int> keys(no_of_items);
+    for (auto& key : keys)
+        key = key_distr(rnd);
+
+    std::vector<int> lookups(no_of_items);
+    for (auto& key : lookups)
+        key = key_distr(rnd) % 2 ? keys[key_distr(rnd) % no_of_items] : key_distr(rnd);
+
+    FlatIntSet<std::optional<int>> std_optional_set{no_of_items};
+    FlatIntSet<OptionalInt> compact_optional_set{no_of_items};
+    for (int key : keys)
+    {
+        std_optional_set.insert(key);
+        compact_optional_set.insert(key);
+    }
+
+    std::cout << "Hash set slots - std::optional<int>: " << std_optional_set.memory_footprint() / 1'000'000
+              << " MB, compact_optional<int>: " << compact_optional_set.memory_footprint() / 1'000'000 << " MB\n";
+
+    BENCHMARK("hash set lookups - std::optional<int>")
+    {
+        size_t found = 0;
+        for (int key : lookups)
+            found += std_optional_set.contains(key);
+        return found;
+    };
+
+    BENCHMARK("hash set lookups - compact_optional<int>")
+    {
+        size_t found = 0;
+        for (int key : lookups)
+            found += compact_optional_set.contains(key);
+        return found;
+    };
+
+    std::bernoulli_distribution is_null{0.1};
+    std::vector<std::optional<int>> std_optionals(4 * no_of_items);
+    std::vector<OptionalInt> compact_optionals(4 * no_of_items);
+    for (size_t i = 0; i < std_optionals.size(); ++i)
+    {
+        if (!is_null(rnd))
+            std_optionals[i] = compact_optionals[i] = key_distr(rnd) % 1'000;
+    }
+
+    BENCHMARK("vector sum - std::optional<int>")
+    {
+        int64_t total = 0;
+        for (const auto& item : std_optionals)
+            total += item.value_or(0);
+        return total;
+    };
+
+    BENCHMARK("vector sum - compact_optional<int>")
+    {
+        int64_t total = 0;
+        for (const auto& item : compact_optionals)
+            total += item.value_or(0);
+        return total;
+    };
+}
@@ -0,0 +1,178 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "optional_vector.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <vector>
+
+using ModernCpp::optional_vector;
+
+TEST_CASE("optional_vector")
+{
+    optional_vector<int> vec = {1, std::nullopt, 3};
+
+    SECTION("optional-like access")
+    {
+        REQUIRE(vec.size() == 3);
+
+        CHECK(vec[0].has_value());
+        CHECK(*vec[0] == 1);
+        CHECK(vec[0] == 1);
+        CHECK_FALSE(vec[1].has_value());
+        CHECK(vec[1] == std::nullopt);
+        CHECK(vec[1].value_or(-1) == -1);
+        CHECK_THROWS_AS(vec[1].value(), std::bad_optional_access);
+
+        std::optional<int> item = vec[2];
+        CHECK(item == 3);
+    }
+
+    SECTION("assignment")
+    {
+        vec[1] = 2;
+        vec[0] = std::nullopt;
+        *vec[2] += 10;
+
+        CHECK(vec[0] == std::nullopt);
+        CHECK(vec[1] == 2);
+        CHECK(vec[2] == 13);
+        CHECK(vec.null_count() == 1);
+    }
+
+    SECTION("constructed with size holds only nulls")
+    {
+        optional_vector<double> nulls(100);
+
+        CHECK(nulls.null_count() == 100);
+        CHECK(nulls.sum() == 0.0);
+        CHECK(nulls.min() == std::nullopt);
+        CHECK(nulls.max() == std::nullopt);
+    }
+
+    SECTION("null-aware aggregates")
+    {
+        CHECK(vec.sum() == 4);
+        CHECK(vec.min() == 1);
+        CHECK(vec.max() == 3);
+
+        optional_vector<int> negative = {std::nullopt, -5, std::nullopt, -3};
+        CHECK(negative.max() == -3); // nulls are not treated as 0
+        CHECK(negative.min() == -5);
+    }
+
+    SECTION("aggregates agree with std::vector<std::optional>")
+    {
+        std::mt19937 rnd{42};
+        std::uniform_int_distribution<int> value_distr{-1'000, 1'000};
+
+        for (int null_percent : {0, 10, 50, 90, 100})
+        {
+            std::bernoulli_distribution is_null{null_percent / 100.0};
+
+            std::vector<std::optional<int>> expected;
+            optional_vector<int> column;
+
+            for (int i = 0; i < 1'000; ++i) // not a multiple of 64
+            {
+                std::optional<int> item = is_null(rnd) ? std::nullopt : std::optional{value_distr(rnd)};
+                expected.push_back(item);
+                column.push_back(item);
+            }
+
+            int64_t expected_sum = 0;
+            std::optional<int> expected_min, expected_max;
+            for (const auto& item : expected)
+            {
+                if (!item)
+                    continue;
+                expected_sum += *item;
+                expected_min = std::min(expected_min.value_or(*item), *item);
+                expected_max = std::max(expected_max.value_or(*item), *item);
+            }
+
+            INFO("nulls: " << null_percent << "%");
+            CHECK(column.sum() == expected_sum);
+            CHECK(column.min() == expected_min);
+            CHECK(column.max() == expected_max);
+            CHECK(column.null_count() == static_cast<size_t>(std::ranges::count(expected, std::optional<int>{})));
+        }
+    }
+
+    SECTION("memory footprint")
+    {
+        optional_vector<int> column;
+        column.reserve(64'000);
+
+        CHECK(column.memory_footprint() == 64'000 * sizeof(int) + 1'000 * sizeof(uint64_t));
+        CHECK(sizeof(std::optional<int>) == 2 * sizeof(int));
+    }
+}
+
+TEST_CASE("nullable column aggregates", "[.][benchmark]")
+{
+    constexpr size_t no_of_items = 20'000'000;
+
+    std::mt19937 rnd{665};
+    std::uniform_int_distribution<int> value_distr{-1'000'000, 1'000'000};
+    std::bernoulli_distribution is_null{0.1};
+
+    std::vector<std::optional<int>> optionals;
+    optionals.reserve(no_of_items);
+    optional_vector<int> column;
+    column.reserve(no_of_items);
+
+    for (size_t i = 0; i < no_of_items; ++i)
+    {
+        std::optional<int> item = is_null(rnd) ? std::nullopt : std::optional{value_distr(rnd)};
+        optionals.push_back(item);
+        column.push_back(item);
+    }
+
+    std::cout << "Memory - std::vector<std::optional<int>>: " << optionals.capacity() * sizeof(std::optional<int>) / 1'000'000
+              << " MB, optional_vector<int>: " << column.memory_footprint() / 1'000'000 << " MB\n";
+
+    BENCHMARK("sum - std::vector<std::optional<int>>")
+    {
+        int64_t total = 0;
+        for (const auto& item : optionals)
+            if (item)
+                total += *item;
+        return total;
+    };
+
+    BENCHMARK("sum - optional_vector<int>")
+    {
+        return column.sum();
+    };
+
+    BENCHMARK("min - std::vector<std::optional<int>>")
+    {
+        std::optional<int> result;
+        for (const auto& item : optionals)
+            if (item && (!result || *item < *result))
+                result = item;
+        return result;
+    };
+
+    BENCHMARK("min - optional_vector<int>")
+    {
+        return column.min();
+    };
+
+    BENCHMARK("max - std::vector<std::optional<int>>")
+    {
+        std::optional<int> result;
+        for (const auto& item : optionals)
+            if (item && (!result || *result < *item))
+                result = item;
+        return result;
+    };
+
+    BENCHMARK("max - optional_vector<int>")
+    {
+        return column.max();
+    };
+}
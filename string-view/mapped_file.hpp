@@ -0,0 +1,221 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_FILE_USES_MMAP 1
+#else
+#include <fstream>
+#endif
+
+namespace FileIO
+{
+    // Range of lines in the text (without '\n') - lines are views, nothing is copied
+    // - the last line does not have to end with '\n' (the same as std::getline)
+    class LineView
+    {
+        std::string_view text_;
+
+    public:
+        class iterator
+        {
+            const char* position_{nullptr}; // beginning of the next line
+            const char* end_{nullptr};
+            std::string_view line_{};
+
+        public:
+            using iterator_category = std::input_iterator_tag; // reference is not a real reference
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::string_view;
+            using pointer = void;
+
+            iterator() = default;
+
+            explicit iterator(std::string_view text)
+                : position_{text.data()}
+                , end_{text.data() + text.size()}
+            {
+                next_line();
+            }
+
+            std::string_view operator*() const
+            {
+                return line_;
+            }
+
+            iterator& operator++()
+            {
+                next_line();
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                iterator temp{*this};
+                next_line();
+                return temp;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return line_.data() == other.line_.data();
+            }
+
+        private:
+            void next_line()
+            {
+                if (position_ == end_)
+                {
+                    line_ = {}; // end
+                    return;
+                }
+
+                auto eol = static_cast<const char*>(std::memchr(position_, '\n', end_ - position_)); // vectorized by libc
+                const char* line_end = eol ? eol : end_;
+
+                line_ = std::string_view(position_, line_end - position_);
+                position_ = eol ? eol + 1 : end_;
+            }
+        };
+
+        explicit LineView(std::string_view text)
+            : text_{text}
+        {
+        }
+
+        iterator begin() const
+        {
+            return iterator{text_};
+        }
+
+        iterator end() const
+        {
+            return iterator{};
+        }
+    };
+
+    // Read-only view of the whole file mapped into memory (RAII):
+    // - content is exposed as std::string_view - the file is never copied into std::string
+    // - mapping is released by the deleter of std::unique_ptr (like FILE* closed by fclose)
+    // - access hint is passed to the kernel with madvise (sequential -> aggressive read-ahead)
+    // - views of the content must not outlive the MappedFile
+    // - on platforms without mmap the file is read into the buffer
+    class MappedFile
+    {
+    public:
+        enum class Access
+        {
+            normal,
+            sequential,
+            random
+        };
+
+    private:
+#ifdef MAPPED_FILE_USES_MMAP
+        struct Unmapper
+        {
+            size_t size;
+
+            void operator()(const char* data) const
+            {
+                ::munmap(const_cast<char*>(data), size);
+            }
+        };
+
+        std::unique_ptr<const char, Unmapper> data_{nullptr, Unmapper{0}};
+#else
+        std::unique_ptr<char[]> data_;
+#endif
+        size_t size_{0};
+
+    public:
+        explicit MappedFile(const std::filesystem::path& path, Access access = Access::sequential)
+        {
+#ifdef MAPPED_FILE_USES_MMAP
+            auto file_closer = [](const int* fd) { ::close(*fd); };
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd == -1)
+                throw_last_error("open", path);
+            std::unique_ptr<const int, decltype(file_closer)> fd_guard{&fd, file_closer}; // mapping outlives the descriptor
+
+            struct stat file_stat;
+            if (::fstat(fd, &file_stat) == -1)
+                throw_last_error("fstat", path);
+
+            size_ = static_cast<size_t>(file_stat.st_size);
+            if (size_ == 0)
+                return; // empty file cannot be mapped
+
+            void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED)
+                throw_last_error("mmap", path);
+
+            data_ = std::unique_ptr<const char, Unmapper>{static_cast<const char*>(address), Unmapper{size_}};
+
+            ::madvise(address, size_, access == Access::sequential ? MADV_SEQUENTIAL : access == Access::random ? MADV_RANDOM : MADV_NORMAL);
+#else
+            std::ifstream file{path, std::ios::binary};
+            if (!file)
+                throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), "Cannot open " + path.string());
+
+            size_ = static_cast<size_t>(std::filesystem::file_size(path));
+            data_ = std::make_unique_for_overwrite<char[]>(size_);
+            file.read(data_.get(), size_);
+            (void)access;
+#endif
+        }
+
+        MappedFile(MappedFile&& other) noexcept
+            : data_{std::move(other.data_)}
+            , size_{std::exchange(other.size_, 0)}
+        {
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            data_ = std::move(other.data_);
+            size_ = std::exchange(other.size_, 0);
+
+            return *this;
+        }
+
+        std::string_view content() const
+        {
+            return std::string_view(data_.get(), size_);
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        LineView lines() const
+        {
+            return LineView{content()};
+        }
+
+    private:
+        [[noreturn]] static void throw_last_error(const char* operation, const std::filesystem::path& path)
+        {
+            throw std::system_error(errno, std::generic_category(), std::string(operation) + " failed for " + path.string());
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,183 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "mapped_file.hpp"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    // file removed at the end of the scope
+    class TempFile
+    {
+        std::filesystem::path path_;
+
+    public:
+        TempFile(std::string_view name, std::string_view content)
+            : path_{std::filesystem::temp_directory_path() / name}
+        {
+            std::ofstream file{path_, std::ios::binary};
+            file.write(content.data(), content.size());
+        }
+
+        TempFile(const TempFile&) = delete;
+        TempFile& operator=(const TempFile&) = delete;
+
+        ~TempFile()
+        {
+            std::error_code ec;
+            std::filesystem::remove(path_, ec);
+        }
+
+        const std::filesystem::path& path() const
+        {
+            return path_;
+        }
+    };
+}
+
+TEST_CASE("LineView")
+{
+    using FileIO::LineView;
+
+    auto lines_of = [](std::string_view text) { return std::vector<std::string_view>(LineView{text}.begin(), LineView{text}.end()); };
+
+    CHECK(lines_of("one\ntwo\nthree") == std::vector{"one"sv, "two"sv, "three"sv});
+    CHECK(lines_of("one\ntwo\n") == std::vector{"one"sv, "two"sv});
+    CHECK(lines_of("\n\nlast") == std::vector{""sv, ""sv, "last"sv});
+    CHECK(lines_of("").empty());
+}
+
+TEST_CASE("MappedFile")
+{
+    using FileIO::MappedFile;
+
+    SECTION("content is a view of the whole file")
+    {
+        TempFile file{"mapped_file_test_content.txt", "first line\nsecond line\n"};
+
+        MappedFile mapped_file{file.path()};
+
+        CHECK(mapped_file.size() == 23);
+        CHECK(mapped_file.content() == "first line\nsecond line\n");
+    }
+
+    SECTION("lines")
+    {
+        TempFile file{"mapped_file_test_lines.txt", "a\nbb\n\nccc"};
+
+        MappedFile mapped_file{file.path(), MappedFile::Access::random};
+
+        std::vector<std::string_view> lines;
+        for (std::string_view line : mapped_file.lines())
+            lines.push_back(line);
+
+        CHECK(lines == std::vector{"a"sv, "bb"sv, ""sv, "ccc"sv});
+        CHECK(lines[0].data() == mapped_file.content().data()); // no copies
+    }
+
+    SECTION("empty file")
+    {
+        TempFile file{"mapped_file_test_empty.txt", ""};
+
+        MappedFile mapped_file{file.path()};
+
+        CHECK(mapped_file.content().empty());
+        CHECK(mapped_file.lines().begin() == mapped_file.lines().end());
+    }
+
+    SECTION("move transfers the mapping")
+    {
+        TempFile file{"mapped_file_test_move.txt", "text"};
+
+        MappedFile mapped_file{file.path()};
+        MappedFile target = std::move(mapped_file);
+
+        CHECK(target.content() == "text");
+        CHECK(mapped_file.content().empty());
+    }
+
+    SECTION("missing file throws")
+    {
+        CHECK_THROWS_AS(MappedFile{"/this/file/does/not/exist.txt"}, std::system_error);
+    }
+}
+
+TEST_CASE("scanning lines of a big file", "[.][benchmark]")
+{
+    std::string content;
+    for (int i = 0; content.size() < 256 * 1024 * 1024; ++i)
+        content += "2023-09-11 12:00:00 INFO request " + std::to_string(i) + " handled in " + std::to_string(i % 1000) + "ms\n";
+
+    TempFile file{"mapped_file_benchmark.txt", content};
+    content.clear();
+    content.shrink_to_fit();
+
+    struct Stats
+    {
+        size_t no_of_lines = 0;
+        size_t no_of_bytes = 0;
+    };
+
+    auto scan_with_getline = [&] {
+        Stats stats;
+        std::ifstream in{file.path()};
+        std::string line;
+
+        while (std::getline(in, line))
+        {
+            ++stats.no_of_lines;
+            stats.no_of_bytes += line.size();
+        }
+
+        return stats;
+    };
+
+    auto scan_with_mapped_file = [&](FileIO::MappedFile::Access access) {
+        Stats stats;
+        FileIO::MappedFile mapped_file{file.path(), access};
+
+        for (std::string_view line : mapped_file.lines())
+        {
+            ++stats.no_of_lines;
+            stats.no_of_bytes += line.size();
+        }
+
+        return stats;
+    };
+
+    auto print_throughput = [&](std::string_view name, auto scan) {
+        auto start = std::chrono::steady_clock::now();
+        Stats stats = scan();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << name << ": " << std::filesystem::file_size(file.path()) / elapsed.count() / 1e9 << " GB/s ("
+                  << stats.no_of_lines << " lines)\n";
+    };
+
+    print_throughput("std::getline", scan_with_getline);
+    print_throughput("MappedFile - sequential", [&] { return scan_with_mapped_file(FileIO::MappedFile::Access::sequential); });
+    print_throughput("MappedFile - normal", [&] { return scan_with_mapped_file(FileIO::MappedFile::Access::normal); });
+
+    BENCHMARK("std::getline")
+    {
+        return scan_with_getline().no_of_lines;
+    };
+
+    BENCHMARK("MappedFile - sequential")
+    {
+        return scan_with_mapped_file(FileIO::MappedFile::Access::sequential).no_of_lines;
+    };
+
+    BENCHMARK("MappedFile - normal")
+    {
+        return scan_with_mapped_file(FileIO::MappedFile::Access::normal).no_of_lines;
+    };
+}
@@ -0,0 +1,172 @@
+#ifndef SHAPE_STORE_HPP
+#define SHAPE_STORE_HPP
+
+#include "shapes.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace VariantPoly
+{
+    namespace Kernels
+    {
+        // sum of x[i] * y[i] computed in double precision (no int overflow for big shapes)
+        inline double sum_of_products(const int* x, const int* y, size_t n)
+        {
+            size_t i = 0;
+            double total = 0.0;
+
+#if defined(__AVX2__)
+            __m256d acc_1 = _mm256_setzero_pd();
+            __m256d acc_2 = _mm256_setzero_pd();
+
+            for (; i + 8 <= n; i += 8)
+            {
+                __m256i xs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+                __m256i ys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i));
+
+                __m256d x_lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(xs));
+                __m256d x_hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(xs, 1));
+                __m256d y_lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(ys));
+                __m256d y_hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(ys, 1));
+
+                acc_1 = _mm256_add_pd(acc_1, _mm256_mul_pd(x_lo, y_lo));
+                acc_2 = _mm256_add_pd(acc_2, _mm256_mul_pd(x_hi, y_hi));
+            }
+
+            alignas(32) double lanes[4];
+            _mm256_store_pd(lanes, _mm256_add_pd(acc_1, acc_2));
+            total = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(__SSE2__) || defined(_M_X64)
+            __m128d acc_1 = _mm_setzero_pd();
+            __m128d acc_2 = _mm_setzero_pd();
+
+            for (; i + 4 <= n; i += 4)
+            {
+                __m128i xs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+                __m128i ys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + i));
+
+                __m128d x_lo = _mm_cvtepi32_pd(xs);
+                __m128d x_hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(xs, _MM_SHUFFLE(1, 0, 3, 2)));
+                __m128d y_lo = _mm_cvtepi32_pd(ys);
+                __m128d y_hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(ys, _MM_SHUFFLE(1, 0, 3, 2)));
+
+                acc_1 = _mm_add_pd(acc_1, _mm_mul_pd(x_lo, y_lo));
+                acc_2 = _mm_add_pd(acc_2, _mm_mul_pd(x_hi, y_hi));
+            }
+
+            alignas(16) double lanes[2];
+            _mm_store_pd(lanes, _mm_add_pd(acc_1, acc_2));
+            total = lanes[0] + lanes[1];
+#endif
+
+            for (; i < n; ++i)
+                total += static_cast<double>(x[i]) * y[i];
+
+            return total;
+        }
+
+        inline double sum_of_squares(const int* x, size_t n)
+        {
+            return sum_of_products(x, x, n);
+        }
+    }
+
+    // Type-partitioned (structure-of-arrays) container of shapes:
+    // every alternative of Shape::ShapeType is kept in its own contiguous column,
+    // so total_area() is a handful of branch-free vectorized loops instead of std::visit per item
+    class ShapeStore
+    {
+        std::vector<int> radii_;
+        std::vector<int> widths_;
+        std::vector<int> heights_;
+        std::vector<int> sizes_;
+
+    public:
+        ShapeStore() = default;
+
+        template <typename TIterator>
+        ShapeStore(TIterator first, TIterator last)
+        {
+            for (; first != last; ++first)
+                add(*first);
+        }
+
+        void add(const Circle& c)
+        {
+            radii_.push_back(c.radius);
+        }
+
+        void add(const Rectangle& r)
+        {
+            widths_.push_back(r.width);
+            heights_.push_back(r.height);
+        }
+
+        void add(const Square& s)
+        {
+            sizes_.push_back(s.size);
+        }
+
+        void add(const Shape& shp)
+        {
+            std::visit([this](const auto& s) { add(s); }, shp.shp);
+        }
+
+        void reserve(size_t circles, size_t rectangles, size_t squares)
+        {
+            radii_.reserve(circles);
+            widths_.reserve(rectangles);
+            heights_.reserve(rectangles);
+            sizes_.reserve(squares);
+        }
+
+        void clear()
+        {
+            radii_.clear();
+            widths_.clear();
+            heights_.clear();
+            sizes_.clear();
+        }
+
+        size_t size() const
+        {
+            return radii_.size() + widths_.size() + sizes_.size();
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        template <typename TShape>
+        size_t count() const
+        {
+            if constexpr (std::is_same_v<TShape, Circle>)
+                return radii_.size();
+            else if constexpr (std::is_same_v<TShape, Rectangle>)
+                return widths_.size();
+            else
+            {
+                static_assert(std::is_same_v<TShape, Square>, "Unsupported shape type");
+                return sizes_.size();
+            }
+        }
+
+        double total_area() const
+        {
+            constexpr double pi = 3.1415; // the same constant as Circle::area()
+
+            return pi * Kernels::sum_of_squares(radii_.data(), radii_.size())
+                + Kernels::sum_of_products(widths_.data(), heights_.data(), widths_.size())
+                + Kernels::sum_of_squares(sizes_.data(), sizes_.size());
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef SHAPES_HPP
+#define SHAPES_HPP
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace ClassicPoly
+{
+    struct Shape
+    {
+        virtual ~Shape() = default;
+        virtual double area() const = 0;
+    };
+
+    struct Circle : Shape
+    {
+        int radius;
+
+        Circle(int r) : radius(r)
+        {}
+
+        double area() const override
+        {
+            return radius * radius * 3.1415;
+        }
+    };
+
+    struct Rectangle : Shape
+    {
+        int width, height;
+
+        Rectangle(int w, int h) : width{w}, height{h}
+        {}
+
+        double area() const override
+        {
+            return width * height;
+        }
+    };
+
+    struct Square : Shape
+    {
+        int size;
+
+        Square(int s) : size{s}
+        {}
+
+        double area() const override
+        {
+            return size * size;
+        }
+    };
+}
+
+namespace VariantPoly
+{
+    struct Circle
+    {
+        int radius;   
+
+        double area() const
+        {
+            return radius * radius * 3.1415;
+        }
+    };
+
+    struct Rectangle
+    {
+        int width, height;    
+
+        double area() const
+        {
+            return width * height;
+        }
+    };
+
+    struct Square
+    {
+        int size; 
+
+        double area() const
+        {
+            return size * size;
+        }
+    };
+
+    template<typename T1, typename T2>
+    struct IsSimilar
+    {
+        static constexpr bool value = std::is_same_v<std::remove_cvref_t<T1>, std::remove_cvref_t<T2>>;
+    };
+
+    template<typename T1, typename T2>
+    constexpr bool IsSimilar_v = IsSimilar<T1, T2>::value;
+
+    // Polymorphic wrapper
+    struct Shape
+    {
+        using ShapeType = std::variant<Circle, Rectangle, Square>;
+
+        ShapeType shp;
+
+        template <typename T, typename = std::enable_if_t<!IsSimilar_v<T, Shape>>> 
+        Shape(T&& s) : shp{std::forward<T>(s)}
+        {}        
+
+        double area() const
+        {
+            return std::visit([](const auto& s) { return s.area(); }, shp);
+        }
+    };
+}
+
+#endif
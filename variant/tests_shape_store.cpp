@@ -0,0 +1,136 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include "shape_store.hpp"
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+TEST_CASE("ShapeStore")
+{
+    using namespace VariantPoly;
+
+    SECTION("default construction - empty store")
+    {
+        ShapeStore store;
+
+        CHECK(store.empty());
+        CHECK(store.size() == 0);
+        CHECK(store.total_area() == 0.0);
+    }
+
+    SECTION("shapes are partitioned by type")
+    {
+        ShapeStore store;
+        store.add(Circle{1});
+        store.add(Rectangle{10, 1});
+        store.add(Square{10});
+        store.add(Shape{Square{2}});
+
+        CHECK(store.size() == 4);
+        CHECK(store.count<Circle>() == 1);
+        CHECK(store.count<Rectangle>() == 1);
+        CHECK(store.count<Square>() == 2);
+    }
+
+    SECTION("total_area is the same as for vector<Shape>")
+    {
+        std::vector<Shape> shapes;
+
+        std::mt19937 rnd{665};
+        std::uniform_int_distribution<int> distr(0, 1000);
+
+        for (int i = 0; i < 1001; ++i) // odd size - kernel tails are exercised
+        {
+            switch (i % 3)
+            {
+            case 0:
+                shapes.push_back(Circle{distr(rnd)});
+                break;
+            case 1:
+                shapes.push_back(Rectangle{distr(rnd), distr(rnd)});
+                break;
+            default:
+                shapes.push_back(Square{distr(rnd)});
+            }
+        }
+
+        ShapeStore store(shapes.begin(), shapes.end());
+
+        double expected = std::accumulate(shapes.begin(), shapes.end(), 0.0,
+            [](double total, const Shape& shp) { return total + shp.area(); });
+
+        CHECK(store.size() == shapes.size());
+        CHECK(store.total_area() == Catch::Approx(expected));
+    }
+
+    SECTION("clear")
+    {
+        ShapeStore store;
+        store.add(Circle{1});
+        store.clear();
+
+        CHECK(store.empty());
+    }
+}
+
+TEST_CASE("total area - classic vs. variant vs. ShapeStore", "[.][benchmark]")
+{
+    constexpr size_t no_of_shapes = 1'000'000;
+
+    std::vector<std::unique_ptr<ClassicPoly::Shape>> classic_shapes;
+    std::vector<VariantPoly::Shape> variant_shapes;
+    VariantPoly::ShapeStore store;
+
+    classic_shapes.reserve(no_of_shapes);
+    variant_shapes.reserve(no_of_shapes);
+    store.reserve(no_of_shapes / 3 + 1, no_of_shapes / 3 + 1, no_of_shapes / 3 + 1);
+
+    std::mt19937 rnd{42};
+    std::uniform_int_distribution<int> distr(1, 100);
+
+    for (size_t i = 0; i < no_of_shapes; ++i)
+    {
+        int a = distr(rnd);
+        int b = distr(rnd);
+
+        switch (rnd() % 3)
+        {
+        case 0:
+            classic_shapes.push_back(std::make_unique<ClassicPoly::Circle>(a));
+            variant_shapes.push_back(VariantPoly::Circle{a});
+            break;
+        case 1:
+            classic_shapes.push_back(std::make_unique<ClassicPoly::Rectangle>(a, b));
+            variant_shapes.push_back(VariantPoly::Rectangle{a, b});
+            break;
+        default:
+            classic_shapes.push_back(std::make_unique<ClassicPoly::Square>(a));
+            variant_shapes.push_back(VariantPoly::Square{a});
+        }
+
+        store.add(variant_shapes.back());
+    }
+
+    BENCHMARK("ClassicPoly - vector<unique_ptr<Shape>>")
+    {
+        double total_area = 0.0;
+        for (const auto& shp : classic_shapes)
+            total_area += shp->area();
+        return total_area;
+    };
+
+    BENCHMARK("VariantPoly - vector<Shape>")
+    {
+        double total_area = 0.0;
+        for (const auto& shp : variant_shapes)
+            total_area += shp.area();
+        return total_area;
+    };
+
+    BENCHMARK("VariantPoly - ShapeStore")
+    {
+        return store.total_area();
+    };
+}
@@ -1,7 +1,9 @@
 #include <algorithm>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include "shapes.hpp"
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <string>
 #include <variant>
@@ -118,111 +120,6 @@ TEST_CASE("using variant")
 
 ///////////////
 
-namespace ClassicPoly
-{
-    struct Shape
-    {
-        virtual ~Shape() = default;
-        virtual double area() const = 0;
-    };
-
-    struct Circle : Shape
-    {
-        int radius;
-
-        Circle(int r) : radius(r)
-        {}
-
-        double area() const override
-        {
-            return radius * radius * 3.1415;
-        }
-    };
-
-    struct Rectangle : Shape
-    {
-        int width, height;
-
-        Rectangle(int w, int h) : width{w}, height{h}
-        {}
-
-        double area() const override
-        {
-            return width * height;
-        }
-    };
-
-    struct Square : Shape
-    {
-        int size;
-
-        Square(int s) : size{s}
-        {}
-
-        double area() const override
-        {
-            return size * size;
-        }
-    };
-}
-
-namespace VariantPoly
-{
-    struct Circle
-    {
-        int radius;   
-
-        double area() const
-        {
-            return radius * radius * 3.1415;
-        }
-    };
-
-    struct Rectangle
-    {
-        int width, height;    
-
-        double area() const
-        {
-            return width * height;
-        }
-    };
-
-    struct Square
-    {
-        int size; 
-
-        double area() const
-        {
-            return size * size;
-        }
-    };
-
-    //template<typename T1, typename T2>
-    //struct is_similar
-    //{
-    //    static constexpr bool value = 
-    //};
-
-    // Polymorphic wrapper
-    struct Shape
-    {
-        using ShapeType = variant<Circle, Rectangle, Square>;
-
-        ShapeType shp;
-
-        template <typename T, typename = std::enable_if_t<!IsSimilar_v<T, Shape>>> 
-        Shape(T&& s) : shp{std::forward<T>(s)}
-        {}        
-
-        double area() const
-        {
-            return std::visit([](const auto& s) { return s.area(); }, shp);
-        }
-    };
-}
-
-
 TEST_CASE("classic poly")
 {
     using namespace ClassicPoly;